@@ -50,6 +50,8 @@ constexpr int ipStallSamplingReportShift = 5;
 constexpr int stallSamplingReportCategoryMask = 0xff;
 // Offset to access Stall Sampling Report Sub Slice and flags.
 constexpr int stallSamplingReportSubSliceAndFlagsOffset = 48;
+// Upper bound of stall counters decoded from a single Stall Sampling report.
+constexpr uint32_t maxStallSamplingReportCounterCount = 16u;
 
 struct Event;
 struct Device;
@@ -107,9 +109,7 @@ class L0GfxCoreHelper : public NEO::ApiGfxCoreHelper {
     virtual ze_mutable_command_exp_flags_t getPlatformCmdListUpdateCapabilities() const = 0;
     virtual void appendPlatformSpecificExtensions(std::vector<std::pair<std::string, uint32_t>> &extensions, const NEO::ProductHelper &productHelper, const NEO::HardwareInfo &hwInfo) const = 0;
     virtual std::vector<std::pair<const char *, const char *>> getStallSamplingReportMetrics() const = 0;
-    virtual void stallSumIpDataToTypedValues(uint64_t ip, void *sumIpData, std::vector<zet_typed_value_t> &ipDataValues) = 0;
-    virtual bool stallIpDataMapUpdate(std::map<uint64_t, void *> &stallSumIpDataMap, const uint8_t *pRawIpData) = 0;
-    virtual void stallIpDataMapDelete(std::map<uint64_t, void *> &stallSumIpDataMap) = 0;
+    virtual bool stallIpDataDecode(const uint8_t *pRawIpData, uint64_t &ip, uint64_t *stallCounts) const = 0;
     virtual uint32_t getIpSamplingMetricCount() = 0;
     virtual bool synchronizedDispatchSupported() const = 0;
     virtual bool implicitSynchronizedDispatchForCooperativeKernelsAllowed() const = 0;
@@ -157,9 +157,7 @@ class L0GfxCoreHelperHw : public L0GfxCoreHelper {
     ze_mutable_command_exp_flags_t getPlatformCmdListUpdateCapabilities() const override;
     void appendPlatformSpecificExtensions(std::vector<std::pair<std::string, uint32_t>> &extensions, const NEO::ProductHelper &productHelper, const NEO::HardwareInfo &hwInfo) const override;
     std::vector<std::pair<const char *, const char *>> getStallSamplingReportMetrics() const override;
-    void stallSumIpDataToTypedValues(uint64_t ip, void *sumIpData, std::vector<zet_typed_value_t> &ipDataValues) override;
-    bool stallIpDataMapUpdate(std::map<uint64_t, void *> &stallSumIpDataMap, const uint8_t *pRawIpData) override;
-    void stallIpDataMapDelete(std::map<uint64_t, void *> &stallSumIpDataMap) override;
+    bool stallIpDataDecode(const uint8_t *pRawIpData, uint64_t &ip, uint64_t *stallCounts) const override;
     uint32_t getIpSamplingMetricCount() override;
     bool synchronizedDispatchSupported() const override;
     bool implicitSynchronizedDispatchForCooperativeKernelsAllowed() const override;
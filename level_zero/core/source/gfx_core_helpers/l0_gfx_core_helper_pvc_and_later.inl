@@ -7,13 +7,17 @@
 
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/definitions/engine_group_types.h"
 #include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/string.h"
 
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 
+#include <bitset>
+
 namespace L0 {
 
 template <typename Family>
@@ -46,29 +50,36 @@ std::vector<EuThread::ThreadId> L0GfxCoreHelperHw<Family>::getThreadsFromAttenti
     const uint32_t numThreadsPerEu = (hwInfo.gtSystemInfo.ThreadCount / hwInfo.gtSystemInfo.EUCount);
     const uint32_t bytesPerEu = alignUp(numThreadsPerEu, 8) / 8;
     const uint32_t threadsSizePerSlice = numSubslicesPerSlice * numEuPerSubslice * bytesPerEu;
-    const uint32_t threadsSizePerSubSlice = numEuPerSubslice * bytesPerEu;
     const uint32_t highestEnabledSlice = NEO::GfxCoreHelper::getHighestEnabledSlice(hwInfo);
+    const size_t usedBitmaskSize = std::min(bitmaskSize, static_cast<size_t>(std::max(highestEnabledSlice, hwInfo.gtSystemInfo.MaxSlicesSupported)) * threadsSizePerSlice);
+
+    // Bitmask is scanned in dwords: empty dwords are skipped and set bits are found with bit scan,
+    // so cost depends on number of threads with attention rather than on device size
+    constexpr size_t dwordBits = 32;
+    size_t threadCount = 0;
+    for (size_t offset = 0; offset < usedBitmaskSize; offset += sizeof(uint32_t)) {
+        uint32_t dword = 0;
+        memcpy_s(&dword, sizeof(dword), bitmask + offset, std::min(sizeof(dword), usedBitmaskSize - offset));
+        threadCount += std::bitset<dwordBits>(dword).count();
+    }
 
     std::vector<EuThread::ThreadId> threads;
+    threads.reserve(threadCount);
 
-    for (uint32_t slice = 0; slice < std::max(highestEnabledSlice, hwInfo.gtSystemInfo.MaxSlicesSupported); slice++) {
-        for (uint32_t subslice = 0; subslice < numSubslicesPerSlice; subslice++) {
-            for (uint32_t eu = 0; eu < hwInfo.gtSystemInfo.MaxEuPerSubSlice; eu++) {
-                size_t offset = slice * threadsSizePerSlice + subslice * threadsSizePerSubSlice + eu * bytesPerEu;
-
-                if (offset >= bitmaskSize) {
-                    return threads;
-                }
-
-                for (uint32_t byte = 0; byte < bytesPerEu; byte++) {
-                    std::bitset<8> bits(bitmask[offset + byte]);
-                    for (uint32_t i = 0; i < 8; i++) {
-                        if (bits.test(i)) {
-                            threads.emplace_back(tile, slice, subslice, eu, i + 8 * byte);
-                        }
-                    }
-                }
-            }
+    for (size_t offset = 0; offset < usedBitmaskSize; offset += sizeof(uint32_t)) {
+        uint32_t dword = 0;
+        memcpy_s(&dword, sizeof(dword), bitmask + offset, std::min(sizeof(dword), usedBitmaskSize - offset));
+
+        while (dword != 0) {
+            const uint32_t bit = Math::getMinLsbSet(dword);
+            dword &= dword - 1;
+
+            const size_t byteOffset = offset + bit / 8;
+            const uint32_t euIndex = static_cast<uint32_t>(byteOffset / bytesPerEu);
+            const uint32_t thread = static_cast<uint32_t>(byteOffset % bytesPerEu) * 8 + bit % 8;
+            const uint32_t subsliceIndex = euIndex / numEuPerSubslice;
+
+            threads.emplace_back(tile, subsliceIndex / numSubslicesPerSlice, subsliceIndex % numSubslicesPerSlice, euIndex % numEuPerSubslice, thread);
         }
     }
 
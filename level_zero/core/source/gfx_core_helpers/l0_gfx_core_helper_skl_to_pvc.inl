@@ -10,8 +10,6 @@
 
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 
-#include <map>
-
 namespace L0 {
 constexpr uint32_t ipSamplingMetricCount = 10u;
 
@@ -59,20 +57,6 @@ bool L0GfxCoreHelperHw<Family>::forceDefaultUsmCompressionSupport() const {
  * total size 64 bytes
  */
 
-#pragma pack(1)
-typedef struct StallSumIpData {
-    uint64_t activeCount;
-    uint64_t otherCount;
-    uint64_t controlCount;
-    uint64_t pipeStallCount;
-    uint64_t sendCount;
-    uint64_t distAccCount;
-    uint64_t sbidCount;
-    uint64_t syncCount;
-    uint64_t instFetchCount;
-} StallSumIpData_t;
-#pragma pack()
-
 constexpr uint32_t ipSamplingMetricCountXe = 10u;
 
 template <typename Family>
@@ -80,39 +64,13 @@ uint32_t L0GfxCoreHelperHw<Family>::getIpSamplingMetricCount() {
     return ipSamplingMetricCountXe;
 }
 
+// Order of stallCounts must match stallSamplingReportList
 template <typename Family>
-void L0GfxCoreHelperHw<Family>::stallIpDataMapDelete(std::map<uint64_t, void *> &stallSumIpDataMap) {
-    for (auto i = stallSumIpDataMap.begin(); i != stallSumIpDataMap.end(); i++) {
-        StallSumIpData_t *stallSumData = reinterpret_cast<StallSumIpData_t *>(i->second);
-        if (stallSumData) {
-            delete stallSumData;
-            i->second = nullptr;
-        }
-    }
-}
-
-template <typename Family>
-bool L0GfxCoreHelperHw<Family>::stallIpDataMapUpdate(std::map<uint64_t, void *> &stallSumIpDataMap, const uint8_t *pRawIpData) {
+bool L0GfxCoreHelperHw<Family>::stallIpDataDecode(const uint8_t *pRawIpData, uint64_t &ip, uint64_t *stallCounts) const {
     const uint8_t *tempAddr = pRawIpData;
-    uint64_t ip = 0ULL;
+    ip = 0ULL;
     memcpy_s(reinterpret_cast<uint8_t *>(&ip), sizeof(ip), tempAddr, sizeof(ip));
     ip &= 0x1fffffff;
-    StallSumIpData_t *stallSumData = nullptr;
-    if (stallSumIpDataMap.count(ip) == 0) {
-        stallSumData = new StallSumIpData_t{};
-        stallSumData->activeCount = 0;
-        stallSumData->otherCount = 0;
-        stallSumData->controlCount = 0;
-        stallSumData->pipeStallCount = 0;
-        stallSumData->sendCount = 0;
-        stallSumData->distAccCount = 0;
-        stallSumData->sbidCount = 0;
-        stallSumData->syncCount = 0;
-        stallSumData->instFetchCount = 0;
-        stallSumIpDataMap[ip] = stallSumData;
-    } else {
-        stallSumData = reinterpret_cast<StallSumIpData_t *>(stallSumIpDataMap[ip]);
-    }
     tempAddr += ipStallSamplingOffset;
 
     auto getCount = [&tempAddr]() {
@@ -123,15 +81,25 @@ bool L0GfxCoreHelperHw<Family>::stallIpDataMapUpdate(std::map<uint64_t, void *>
         return static_cast<uint8_t>(tempCount);
     };
 
-    stallSumData->activeCount += getCount();
-    stallSumData->otherCount += getCount();
-    stallSumData->controlCount += getCount();
-    stallSumData->pipeStallCount += getCount();
-    stallSumData->sendCount += getCount();
-    stallSumData->distAccCount += getCount();
-    stallSumData->sbidCount += getCount();
-    stallSumData->syncCount += getCount();
-    stallSumData->instFetchCount += getCount();
+    const uint64_t activeCount = getCount();
+    const uint64_t otherCount = getCount();
+    const uint64_t controlCount = getCount();
+    const uint64_t pipeStallCount = getCount();
+    const uint64_t sendCount = getCount();
+    const uint64_t distAccCount = getCount();
+    const uint64_t sbidCount = getCount();
+    const uint64_t syncCount = getCount();
+    const uint64_t instFetchCount = getCount();
+
+    stallCounts[0] = activeCount;
+    stallCounts[1] = controlCount;
+    stallCounts[2] = pipeStallCount;
+    stallCounts[3] = sendCount;
+    stallCounts[4] = distAccCount;
+    stallCounts[5] = sbidCount;
+    stallCounts[6] = syncCount;
+    stallCounts[7] = instFetchCount;
+    stallCounts[8] = otherCount;
 
 #pragma pack(1)
     struct StallCntrInfo {
@@ -147,52 +115,6 @@ bool L0GfxCoreHelperHw<Family>::stallIpDataMapUpdate(std::map<uint64_t, void *>
     return stallCntrInfo.flags & overflowDropFlag;
 }
 
-// Order of ipDataValues must match stallSamplingReportList
-template <typename Family>
-void L0GfxCoreHelperHw<Family>::stallSumIpDataToTypedValues(uint64_t ip, void *sumIpData, std::vector<zet_typed_value_t> &ipDataValues) {
-    StallSumIpData_t *stallSumData = reinterpret_cast<StallSumIpData_t *>(sumIpData);
-    zet_typed_value_t tmpValueData;
-    tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = ip;
-    ipDataValues.push_back(tmpValueData);
-
-    tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = stallSumData->activeCount;
-    ipDataValues.push_back(tmpValueData);
-
-    tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = stallSumData->controlCount;
-    ipDataValues.push_back(tmpValueData);
-
-    tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = stallSumData->pipeStallCount;
-    ipDataValues.push_back(tmpValueData);
-
-    tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = stallSumData->sendCount;
-    ipDataValues.push_back(tmpValueData);
-
-    tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = stallSumData->distAccCount;
-    ipDataValues.push_back(tmpValueData);
-
-    tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = stallSumData->sbidCount;
-    ipDataValues.push_back(tmpValueData);
-
-    tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = stallSumData->syncCount;
-    ipDataValues.push_back(tmpValueData);
-
-    tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = stallSumData->instFetchCount;
-    ipDataValues.push_back(tmpValueData);
-
-    tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = stallSumData->otherCount;
-    ipDataValues.push_back(tmpValueData);
-}
-
 template <typename Family>
 std::vector<std::pair<const char *, const char *>> L0GfxCoreHelperHw<Family>::getStallSamplingReportMetrics() const {
     std::vector<std::pair<const char *, const char *>> stallSamplingReportList = {
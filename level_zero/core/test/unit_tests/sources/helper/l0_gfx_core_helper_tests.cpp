@@ -19,6 +19,8 @@
 
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 
+#include <tuple>
+
 namespace L0 {
 namespace ult {
 
@@ -414,6 +416,41 @@ HWTEST_F(L0GfxCoreHelperTest, givenBitmaskWithAttentionBitsForHalfOfThreadsWhenG
     }
 }
 
+HWTEST2_F(L0GfxCoreHelperTest, givenBitmaskWithAllAttentionBitsSetForMaxTopologyWhenGettingThreadsThenAllThreadsAreReturnedInOrder, IsAtLeastXeHpcCore) {
+    auto hwInfo = *NEO::defaultHwInfo.get();
+    hwInfo.gtSystemInfo.MaxSlicesSupported = 8;
+    hwInfo.gtSystemInfo.MaxSubSlicesSupported = 8 * 16;
+    hwInfo.gtSystemInfo.MaxEuPerSubSlice = 8;
+    MockExecutionEnvironment executionEnvironment;
+    auto &l0GfxCoreHelper = executionEnvironment.rootDeviceEnvironments[0]->getHelper<L0GfxCoreHelper>();
+
+    std::unique_ptr<uint8_t[]> bitmask;
+    size_t size = 0;
+    l0GfxCoreHelper.getAttentionBitmaskForSingleThreads({}, hwInfo, bitmask, size);
+    memset(bitmask.get(), 0xff, size);
+
+    const uint32_t lastSlice = std::max(NEO::GfxCoreHelper::getHighestEnabledSlice(hwInfo), hwInfo.gtSystemInfo.MaxSlicesSupported) - 1;
+    auto threads = l0GfxCoreHelper.getThreadsFromAttentionBitmask(hwInfo, 0, bitmask.get(), size);
+
+    ASSERT_EQ(size * 8, threads.size());
+    for (size_t i = 1; i < threads.size(); i++) {
+        EXPECT_LT(std::make_tuple(threads[i - 1].slice, threads[i - 1].subslice, threads[i - 1].eu, threads[i - 1].thread),
+                  std::make_tuple(threads[i].slice, threads[i].subslice, threads[i].eu, threads[i].thread));
+    }
+    EXPECT_EQ(lastSlice, threads.back().slice);
+    EXPECT_EQ(15u, threads.back().subslice);
+    EXPECT_EQ(7u, threads.back().eu);
+
+    memset(bitmask.get(), 0, size);
+    bitmask[size - 1] = 0x80;
+    threads = l0GfxCoreHelper.getThreadsFromAttentionBitmask(hwInfo, 0, bitmask.get(), size);
+
+    ASSERT_EQ(1u, threads.size());
+    EXPECT_EQ(lastSlice, threads[0].slice);
+    EXPECT_EQ(15u, threads[0].subslice);
+    EXPECT_EQ(7u, threads[0].eu);
+}
+
 using PlatformsWithFusedEus = IsWithinGfxCore<IGFX_GEN12LP_CORE, IGFX_XE_HPG_CORE>;
 using L0GfxCoreHelperFusedEuTest = L0GfxCoreHelperTest;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,9 @@
 
 #include "test_api_tracing_common.h"
 
+#include <atomic>
+#include <thread>
+
 namespace L0 {
 namespace ult {
 
@@ -183,6 +186,79 @@ TEST_F(ZeApiTracingCoreTests, WhenCreateTracerAndsetCallbacksAndEnableTracingAnd
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+TEST_F(ZeApiTracingCoreTests, givenNoThreadInsideTracedCallWhenDisablingTracerThenTracerIsDisabledImmediately) {
+    zet_tracer_exp_handle_t apiTracerHandle;
+    zet_tracer_exp_desc_t tracerDesc = {};
+
+    ze_result_t result = zetTracerExpCreate(nullptr, &tracerDesc, &apiTracerHandle);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, apiTracerHandle);
+    auto tracerImp = static_cast<APITracerImp *>(APITracer::fromHandle(apiTracerHandle));
+
+    result = zetTracerExpSetEnabled(apiTracerHandle, true);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    pGlobalAPITracerContextImp->getActiveTracersList();
+    pGlobalAPITracerContextImp->releaseActivetracersList();
+
+    result = zetTracerExpSetEnabled(apiTracerHandle, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(disabledState, tracerImp->tracingState);
+
+    result = zetTracerExpDestroy(apiTracerHandle);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+}
+
+TEST_F(ZeApiTracingCoreTests, givenThreadInsideTracedCallWhenDisablingTracerThenDisableDoesNotWaitAndDestroyWaitsOnlyUntilThreadLeavesCall) {
+    zet_tracer_exp_handle_t apiTracerHandle;
+    zet_tracer_exp_desc_t tracerDesc = {};
+
+    ze_result_t result = zetTracerExpCreate(nullptr, &tracerDesc, &apiTracerHandle);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, apiTracerHandle);
+    auto tracerImp = static_cast<APITracerImp *>(APITracer::fromHandle(apiTracerHandle));
+
+    result = zetTracerExpSetEnabled(apiTracerHandle, true);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    std::atomic<bool> callEntered = false;
+    std::atomic<bool> leaveCall = false;
+    std::atomic<size_t> tracerCount = 0;
+    std::thread tracedThread([&]() {
+        auto tracerArray = static_cast<tracer_array_t *>(pGlobalAPITracerContextImp->getActiveTracersList());
+        tracerCount = tracerArray->tracerArrayCount;
+        callEntered = true;
+        while (!leaveCall) {
+            std::this_thread::yield();
+        }
+        tracerCount = tracerArray->tracerArrayCount;
+        pGlobalAPITracerContextImp->releaseActivetracersList();
+    });
+
+    while (!callEntered) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(1u, tracerCount);
+
+    result = zetTracerExpSetEnabled(apiTracerHandle, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(disabledWaitingState, tracerImp->tracingState);
+
+    result = zetTracerExpSetEnabled(apiTracerHandle, true);
+    EXPECT_EQ(ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE, result);
+
+    auto newTracerArray = static_cast<tracer_array_t *>(pGlobalAPITracerContextImp->getActiveTracersList());
+    EXPECT_EQ(0u, newTracerArray->tracerArrayCount);
+    pGlobalAPITracerContextImp->releaseActivetracersList();
+
+    leaveCall = true;
+    result = zetTracerExpDestroy(apiTracerHandle);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    tracedThread.join();
+    EXPECT_EQ(1u, tracerCount);
+}
+
 TEST_F(ZeApiTracingCoreTests, WhenCallingTracerWrapperWithOnePrologAndNoEpilogWithUserDataAndUserDataMatchingInPrologThenReturnSuccess) {
     MockCommandList commandList;
     ze_result_t result = ZE_RESULT_SUCCESS;
@@ -122,12 +122,36 @@ XE2_HPG_CORETEST_F(L0GfxCoreHelperTestXe2Hpg, GivenXe2HpgWhenGettingCmdlistUpdat
     EXPECT_EQ(63u, l0GfxCoreHelper.getPlatformCmdListUpdateCapabilities());
 }
 
-XE2_HPG_CORETEST_F(L0GfxCoreHelperTestXe2Hpg, GivenXe2HpgWhenCheckingL0HelperForDeletingIpSamplingEntryWithNullValuesThenMapRemainstheSameSize) {
+XE2_HPG_CORETEST_F(L0GfxCoreHelperTestXe2Hpg, GivenXe2HpgWhenDecodingIpSamplingReportThenIpAndStallCountsInMetricOrderAreReturned) {
     auto &l0GfxCoreHelper = getHelper<L0GfxCoreHelper>();
-    std::map<uint64_t, void *> stallSumIpDataMap;
-    stallSumIpDataMap.emplace(std::pair<uint64_t, void *>(0ull, nullptr));
-    l0GfxCoreHelper.stallIpDataMapDelete(stallSumIpDataMap);
-    EXPECT_NE(0u, stallSumIpDataMap.size());
+    // IP in bits [0, 28], 8 bit counters follow, overflow flag in bytes 50 and 51
+    uint8_t rawReport[64] = {};
+    auto setBits = [&rawReport](uint32_t bitOffset, uint64_t value, uint32_t bitCount) {
+        for (uint32_t bit = 0; bit < bitCount; bit++) {
+            if ((value >> bit) & 1u) {
+                rawReport[(bitOffset + bit) / 8] |= static_cast<uint8_t>(1u << ((bitOffset + bit) % 8));
+            }
+        }
+    };
+    setBits(0, 0x1234567, 29);
+    // tdr, other, control, pipe stall, send, dist acc, sbid, sync, inst fetch, active
+    for (uint32_t i = 0; i < 10; i++) {
+        setBits(29 + i * 8, i + 1, 8);
+    }
+
+    uint64_t ip = 0;
+    uint64_t stallCounts[maxStallSamplingReportCounterCount] = {};
+    EXPECT_FALSE(l0GfxCoreHelper.stallIpDataDecode(rawReport, ip, stallCounts));
+    EXPECT_EQ(0x1234567u, ip);
+
+    const uint64_t expectedStallCounts[] = {10, 1, 3, 4, 5, 6, 7, 8, 9, 2};
+    ASSERT_EQ(l0GfxCoreHelper.getIpSamplingMetricCount() - 1, sizeof(expectedStallCounts) / sizeof(expectedStallCounts[0]));
+    for (uint32_t i = 0; i < l0GfxCoreHelper.getIpSamplingMetricCount() - 1; i++) {
+        EXPECT_EQ(expectedStallCounts[i], stallCounts[i]);
+    }
+
+    setBits(50 * 8, 0x100, 16);
+    EXPECT_TRUE(l0GfxCoreHelper.stallIpDataDecode(rawReport, ip, stallCounts));
 }
 
 } // namespace ult
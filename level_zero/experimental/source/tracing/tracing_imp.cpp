@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,8 @@
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/sleep.h"
 
+#include <limits>
+
 namespace L0 {
 
 thread_local ze_bool_t tracingInProgress = 0;
@@ -104,7 +106,7 @@ thread_local ThreadPrivateTracerData myThreadPrivateTracerData;
 ThreadPrivateTracerData::ThreadPrivateTracerData() {
     isInitialized = false;
     onList = false;
-    tracerArrayPointer.store(nullptr, std::memory_order_relaxed);
+    activeEpoch.store(0, std::memory_order_relaxed);
 }
 
 ThreadPrivateTracerData::~ThreadPrivateTracerData() {
@@ -112,7 +114,7 @@ ThreadPrivateTracerData::~ThreadPrivateTracerData() {
         globalAPITracerContextImp.removeThreadTracerDataFromList(this);
         onList = false;
     }
-    tracerArrayPointer.store(nullptr, std::memory_order_relaxed);
+    activeEpoch.store(0, std::memory_order_release);
 }
 
 void ThreadPrivateTracerData::removeThreadTracerDataFromList(void) {
@@ -120,7 +122,7 @@ void ThreadPrivateTracerData::removeThreadTracerDataFromList(void) {
         globalAPITracerContextImp.removeThreadTracerDataFromList(this);
         onList = false;
     }
-    tracerArrayPointer.store(nullptr, std::memory_order_relaxed);
+    activeEpoch.store(0, std::memory_order_release);
 }
 
 bool ThreadPrivateTracerData::testAndSetThreadTracerDataInitializedAndOnList(void) {
@@ -135,45 +137,65 @@ bool ThreadPrivateTracerData::testAndSetThreadTracerDataInitializedAndOnList(voi
 bool APITracerContextImp::isTracingEnabled() { return driverDdiTable.enableTracing; }
 
 //
-// Walk the list of per-thread private data structures, testing
-// whether any of them reference this array.
+// Walk the list of per-thread private data structures, looking for
+// the oldest epoch in which a thread still executing a traced API call
+// has entered it.
 //
-// Return 1 if a reference is found.  Otherwise return 0.
+// Return max uint64_t value if no thread is inside a traced API call.
 //
-ze_bool_t APITracerContextImp::testForTracerArrayReferences(tracer_array_t *tracerArray) {
+uint64_t APITracerContextImp::getOldestActiveEpoch() {
     std::lock_guard<std::mutex> lock(threadTracerDataListMutex);
-    std::list<ThreadPrivateTracerData *>::iterator itr;
-    for (itr = threadTracerDataList.begin();
-         itr != threadTracerDataList.end();
-         itr++) {
-        if ((*itr)->tracerArrayPointer.load(std::memory_order_relaxed) == tracerArray)
-            return 1;
+    uint64_t oldestActiveEpoch = std::numeric_limits<uint64_t>::max();
+    for (auto &threadTracerData : threadTracerDataList) {
+        auto threadEpoch = threadTracerData->activeEpoch.load(std::memory_order_seq_cst);
+        if (threadEpoch != 0 && threadEpoch < oldestActiveEpoch) {
+            oldestActiveEpoch = threadEpoch;
+        }
     }
-    return 0;
+    return oldestActiveEpoch;
+}
+
+//
+// Epoch is quiescent when every thread has either left traced API
+// calls entered before it, or has entered its call in this epoch or later.
+//
+bool APITracerContextImp::isEpochQuiescent(uint64_t epoch) {
+    return getOldestActiveEpoch() >= epoch;
 }
 
 //
-// Walk the retiring_tracer_array_list, checking each member of the list for
-// references by per thread tracer array pointer. Delete and free
-// each tracer array that has no per-thread references.
+// Free each tracer array on the retiring_tracer_array_list, which was
+// retired in a quiescent epoch. Per-thread data is scanned once,
+// regardless of the number of retiring arrays.
 //
 // Return the number of entries on the retiring tracer array list.
 //
-size_t APITracerContextImp::testAndFreeRetiredTracers() {
-    std::list<tracer_array_t *>::iterator itr = this->retiringTracerArrayList.begin();
+size_t APITracerContextImp::freeRetiredTracers() {
+    if (this->retiringTracerArrayList.empty()) {
+        return 0;
+    }
+
+    uint64_t oldestActiveEpoch = getOldestActiveEpoch();
+    auto itr = this->retiringTracerArrayList.begin();
     while (itr != this->retiringTracerArrayList.end()) {
-        tracer_array_t *retiringTracerArray = *itr;
-        itr++;
-        if (testForTracerArrayReferences(retiringTracerArray))
+        if (itr->retireEpoch > oldestActiveEpoch) {
+            itr++;
             continue;
-        this->retiringTracerArrayList.remove(retiringTracerArray);
-        delete[] retiringTracerArray->tracerArrayEntries;
-        delete retiringTracerArray;
+        }
+        delete[] itr->tracerArray->tracerArrayEntries;
+        delete itr->tracerArray;
+        itr = this->retiringTracerArrayList.erase(itr);
     }
     return this->retiringTracerArrayList.size();
 }
 
-size_t APITracerContextImp::updateTracerArrays() {
+//
+// Publish new tracer array built from the list of enabled tracers and
+// retire the previously active one. This never waits for other threads.
+//
+// Return the epoch in which the previously active array was retired.
+//
+uint64_t APITracerContextImp::updateTracerArrays() {
     tracer_array_t *newTracerArray;
     size_t newTracerArrayCount = this->enabledTracerImpList.size();
 
@@ -203,16 +225,20 @@ size_t APITracerContextImp::updateTracerArrays() {
     // threads in this case.
     //
     tracer_array_t *activeTracerArrayShadow = activeTracerArray.load(std::memory_order_relaxed);
-    if (activeTracerArrayShadow != &emptyTracerArray) {
-        retiringTracerArrayList.push_back(activeTracerArrayShadow);
-    }
     //
-    // This active_tracer_array.store must use memory_order_release.
-    // This store DOES signal a logical transfer of tracer state information
-    // from this thread to the tracing threads.
+    // The store of the new array and the epoch increment must be sequentially
+    // consistent with the epoch publication and array load in getActiveTracersList.
+    // Then any thread which may still use the old array has published an epoch
+    // older than the retire epoch before this thread scans per-thread data.
     //
-    activeTracerArray.store(newTracerArray, std::memory_order_release);
-    return testAndFreeRetiredTracers(); // NOLINT(clang-analyzer-cplusplus.NewDeleteLeaks)
+    activeTracerArray.store(newTracerArray, std::memory_order_seq_cst);
+    uint64_t retireEpoch = currentEpoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+
+    if (activeTracerArrayShadow != &emptyTracerArray) {
+        retiringTracerArrayList.push_back({activeTracerArrayShadow, retireEpoch});
+    }
+    freeRetiredTracers(); // NOLINT(clang-analyzer-cplusplus.NewDeleteLeaks)
+    return retireEpoch;
 }
 
 ze_result_t APITracerContextImp::enableTracingImp(struct APITracerImp *tracerImp, ze_bool_t enable) {
@@ -231,9 +257,8 @@ ze_result_t APITracerContextImp::enableTracingImp(struct APITracerImp *tracerImp
     case enabledState:
         if (!enable) {
             enabledTracerImpList.remove(tracerImp);
-            tracerImp->tracingState = disabledWaitingState;
-            if (updateTracerArrays() == 0)
-                tracerImp->tracingState = disabledState;
+            tracerImp->retireEpoch = updateTracerArrays();
+            tracerImp->tracingState = isEpochQuiescent(tracerImp->retireEpoch) ? disabledState : disabledWaitingState;
         }
         result = ZE_RESULT_SUCCESS;
         break;
@@ -264,8 +289,12 @@ ze_result_t APITracerContextImp::enableTracingImp(struct APITracerImp *tracerImp
 // disabled.  The destroy tracer method
 // should NOT free this tracer's memory.
 //
+// Only threads which entered a traced API call before the tracer was
+// disabled are waited for, and the wait does not block enabling or
+// disabling other tracers.
+//
 ze_result_t APITracerContextImp::finalizeDisableImpTracingWait(struct APITracerImp *tracerImp) {
-    std::lock_guard<std::mutex> lock(traceTableMutex);
+    std::unique_lock<std::mutex> lock(traceTableMutex);
     ze_result_t result;
     switch (tracerImp->tracingState) {
     case disabledState:
@@ -276,13 +305,18 @@ ze_result_t APITracerContextImp::finalizeDisableImpTracingWait(struct APITracerI
         result = ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE;
         break;
 
-    case disabledWaitingState:
-        while (testAndFreeRetiredTracers() != 0) {
+    case disabledWaitingState: {
+        uint64_t retireEpoch = tracerImp->retireEpoch;
+        lock.unlock();
+        while (!isEpochQuiescent(retireEpoch)) {
             NEO::sleep(std::chrono::milliseconds(1));
         }
+        lock.lock();
+        freeRetiredTracers();
         tracerImp->tracingState = disabledState;
         result = ZE_RESULT_SUCCESS;
         break;
+    }
 
     default:
         result = ZE_RESULT_ERROR_UNINITIALIZED;
@@ -300,17 +334,14 @@ void *APITracerContextImp::getActiveTracersList() {
         return nullptr;
     }
 
-    do {
-        stableTracerArray = pGlobalAPITracerContextImp->activeTracerArray.load(std::memory_order_acquire);
-        myThreadPrivateTracerData.tracerArrayPointer.store(stableTracerArray, std::memory_order_relaxed);
-    } while (stableTracerArray !=
-             pGlobalAPITracerContextImp->activeTracerArray.load(std::memory_order_relaxed));
+    myThreadPrivateTracerData.activeEpoch.store(pGlobalAPITracerContextImp->currentEpoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+    stableTracerArray = pGlobalAPITracerContextImp->activeTracerArray.load(std::memory_order_seq_cst);
     return (void *)stableTracerArray;
 }
 
 void APITracerContextImp::releaseActivetracersList() {
     if (myThreadPrivateTracerData.testAndSetThreadTracerDataInitializedAndOnList())
-        myThreadPrivateTracerData.tracerArrayPointer.store(nullptr, std::memory_order_relaxed);
+        myThreadPrivateTracerData.activeEpoch.store(0, std::memory_order_release);
 }
 
 } // namespace L0
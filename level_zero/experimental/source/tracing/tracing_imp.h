@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -65,6 +65,7 @@ struct APITracerImp : APITracer {
 
     tracer_array_entry_t tracerFunctions{};
     TracingState tracingState = disabledState;
+    uint64_t retireEpoch = 0;
 
   private:
 };
@@ -79,7 +80,8 @@ class ThreadPrivateTracerData {
     ThreadPrivateTracerData();
     ~ThreadPrivateTracerData();
 
-    std::atomic<tracer_array_t *> tracerArrayPointer;
+    // epoch observed when entering traced API call, 0 when thread is quiescent
+    std::atomic<uint64_t> activeEpoch;
 
   private:
     ThreadPrivateTracerData(const ThreadPrivateTracerData &);
@@ -108,24 +110,37 @@ struct APITracerContextImp : APITracerContext {
     void removeThreadTracerDataFromList(ThreadPrivateTracerData *threadDataP);
 
   private:
+    struct RetiredTracerArray {
+        tracer_array_t *tracerArray;
+        uint64_t retireEpoch;
+    };
+
     std::mutex traceTableMutex;
     tracer_array_t emptyTracerArray = {0, NULL};
     std::atomic<tracer_array_t *> activeTracerArray;
 
+    //
+    // Epoch is advanced each time the active tracer array is replaced.
+    // A replaced array is tagged with the new epoch and may be freed
+    // once no thread is inside a traced API call entered in an older epoch.
+    //
+    std::atomic<uint64_t> currentEpoch{1};
+
     //
     // a list of tracer arrays that were once active, but
     // have been replaced by a new active array.  These
     // once-active tracer arrays may continue for some time
-    // to have references to them among the per-thread
-    // tracer array pointers.
+    // to be used by threads which entered a traced API call
+    // before they were replaced.
     //
-    std::list<tracer_array_t *> retiringTracerArrayList;
+    std::list<RetiredTracerArray> retiringTracerArrayList;
 
     std::list<struct APITracerImp *> enabledTracerImpList;
 
-    ze_bool_t testForTracerArrayReferences(tracer_array_t *tracerArray);
-    size_t testAndFreeRetiredTracers();
-    size_t updateTracerArrays();
+    uint64_t getOldestActiveEpoch();
+    bool isEpochQuiescent(uint64_t epoch);
+    size_t freeRetiredTracers();
+    uint64_t updateTracerArrays();
 
     std::list<ThreadPrivateTracerData *> threadTracerDataList;
     std::mutex threadTracerDataListMutex;
@@ -12,6 +12,7 @@
 #include "shared/source/os_interface/linux/i915.h"
 
 #include "level_zero/sysman/source/shared/linux/kmd_interface/sysman_kmd_interface.h"
+#include "level_zero/sysman/source/shared/linux/pmu/sysman_pmu_event_group.h"
 #include "level_zero/sysman/source/shared/linux/pmu/sysman_pmu_imp.h"
 #include "level_zero/sysman/source/shared/linux/sysman_hw_device_id_linux.h"
 #include "level_zero/sysman/source/shared/linux/zes_os_sysman_imp.h"
@@ -77,7 +78,12 @@ ze_result_t LinuxEngineImp::getActivity(zes_engine_stats_t *pStats) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
     uint64_t data[2] = {};
-    auto ret = pPmuInterface->pmuRead(static_cast<int>(fd), data, sizeof(data));
+    int ret = 0;
+    if (pEventGroup != nullptr) {
+        ret = pEventGroup->readEvent(static_cast<uint32_t>(eventGroupIndex), data[0], data[1]);
+    } else {
+        ret = pPmuInterface->pmuRead(static_cast<int>(fd), data, sizeof(data));
+    }
     if (ret < 0) {
         NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():pmuRead is returning value:%d and error:0x%x \n", __FUNCTION__, ret, ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
@@ -95,7 +101,23 @@ ze_result_t LinuxEngineImp::getProperties(zes_engine_properties_t &properties) {
     return ZE_RESULT_SUCCESS;
 }
 
+bool LinuxEngineImp::initGroupedActivity() {
+    auto eventGroup = pLinuxSysmanImp->getEngineActivityEventGroup();
+    auto index = eventGroup->addEvent(pSysmanKmdInterface->getEngineActivityConfig(engineGroup, engineInstance, subDeviceId));
+    if (index < 0) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): failed to add engine to PMU event group, using separate event\n", __FUNCTION__);
+        return false;
+    }
+    pEventGroup = std::move(eventGroup);
+    eventGroupIndex = index;
+    fd = pEventGroup->getEventFd(static_cast<uint32_t>(index));
+    return true;
+}
+
 void LinuxEngineImp::init() {
+    if (NEO::debugManager.flags.SysmanEngineActivityPmuGroup.get() == 1 && initGroupedActivity()) {
+        return;
+    }
     fd = pSysmanKmdInterface->getEngineActivityFd(engineGroup, engineInstance, subDeviceId, pPmuInterface);
 }
 
@@ -108,7 +130,7 @@ bool LinuxEngineImp::isEngineModuleSupported() {
 }
 
 LinuxEngineImp::LinuxEngineImp(OsSysman *pOsSysman, zes_engine_group_t type, uint32_t engineInstance, uint32_t subDeviceId, ze_bool_t onSubDevice) : engineGroup(type), engineInstance(engineInstance), subDeviceId(subDeviceId), onSubDevice(onSubDevice) {
-    LinuxSysmanImp *pLinuxSysmanImp = static_cast<LinuxSysmanImp *>(pOsSysman);
+    pLinuxSysmanImp = static_cast<LinuxSysmanImp *>(pOsSysman);
     pDrm = pLinuxSysmanImp->getDrm();
     pDevice = pLinuxSysmanImp->getSysmanDeviceImp();
     pPmuInterface = pLinuxSysmanImp->getPmuInterface();
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 #include "level_zero/sysman/source/api/engine/sysman_os_engine.h"
 #include "level_zero/sysman/source/device/sysman_device_imp.h"
 
+#include <memory>
 #include <unistd.h>
 
 namespace L0 {
@@ -19,6 +20,8 @@ namespace Sysman {
 
 class SysmanKmdInterface;
 class PmuInterface;
+class PmuEventGroup;
+class LinuxSysmanImp;
 struct Device;
 class LinuxEngineImp : public OsEngine, NEO::NonCopyableOrMovableClass {
   public:
@@ -32,7 +35,8 @@ class LinuxEngineImp : public OsEngine, NEO::NonCopyableOrMovableClass {
     LinuxEngineImp() = default;
     LinuxEngineImp(OsSysman *pOsSysman, zes_engine_group_t type, uint32_t engineInstance, uint32_t subDeviceId, ze_bool_t onSubDevice);
     ~LinuxEngineImp() override {
-        if (fd != -1) {
+        // Fd of grouped event is owned by the event group
+        if (fd != -1 && pEventGroup == nullptr) {
             close(static_cast<int>(fd));
             fd = -1;
         }
@@ -47,9 +51,13 @@ class LinuxEngineImp : public OsEngine, NEO::NonCopyableOrMovableClass {
     SysmanDeviceImp *pDevice = nullptr;
     uint32_t subDeviceId = 0;
     ze_bool_t onSubDevice = false;
+    LinuxSysmanImp *pLinuxSysmanImp = nullptr;
+    std::shared_ptr<PmuEventGroup> pEventGroup;
+    int32_t eventGroupIndex = -1;
 
   private:
     void init();
+    bool initGroupedActivity();
     int64_t fd = -1;
 };
 
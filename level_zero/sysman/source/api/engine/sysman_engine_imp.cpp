@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,9 @@
 
 #include "level_zero/sysman/source/api/engine/sysman_engine_imp.h"
 
+#include "level_zero/sysman/source/device/os_sysman.h"
+#include "level_zero/sysman/source/device/sysman_telemetry_sampler.h"
+
 namespace L0 {
 namespace Sysman {
 
@@ -15,6 +18,12 @@ ze_result_t EngineImp::engineGetActivityExt(uint32_t *pCount, zes_engine_stats_t
 }
 
 ze_result_t EngineImp::engineGetActivity(zes_engine_stats_t *pStats) {
+    TelemetrySample sample;
+    if (pActivityHistory != nullptr && pActivityHistory->getLatest(sample)) {
+        pStats->activeTime = sample.values[0];
+        pStats->timestamp = sample.values[1];
+        return ZE_RESULT_SUCCESS;
+    }
     return pOsEngine->getActivity(pStats);
 }
 
@@ -30,12 +39,33 @@ void EngineImp::init() {
     }
 }
 
+void EngineImp::initTelemetrySampling(OsSysman *pOsSysman) {
+    pTelemetrySampler = pOsSysman->getTelemetrySampler();
+    if (pTelemetrySampler == nullptr) {
+        return;
+    }
+    pActivityHistory = pTelemetrySampler->addSource([this](TelemetrySample &sample) {
+        zes_engine_stats_t stats = {};
+        auto result = pOsEngine->getActivity(&stats);
+        sample.values[0] = stats.activeTime;
+        sample.values[1] = stats.timestamp;
+        return result;
+    });
+}
+
 EngineImp::EngineImp(OsSysman *pOsSysman, zes_engine_group_t engineType, uint32_t engineInstance, uint32_t subDeviceId, ze_bool_t onSubdevice) {
     pOsEngine = OsEngine::create(pOsSysman, engineType, engineInstance, subDeviceId, onSubdevice);
     init();
+    if (this->initSuccess) {
+        initTelemetrySampling(pOsSysman);
+    }
 }
 
-EngineImp::~EngineImp() = default;
+EngineImp::~EngineImp() {
+    if (pTelemetrySampler != nullptr) {
+        pTelemetrySampler->removeSource(pActivityHistory.get());
+    }
+}
 
 } // namespace Sysman
 } // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,6 +14,8 @@
 #include <level_zero/zes_api.h>
 namespace L0 {
 namespace Sysman {
+class TelemetryHistory;
+class TelemetrySampler;
 
 class EngineImp : public Engine, NEO::NonCopyableOrMovableClass {
   public:
@@ -29,7 +31,10 @@ class EngineImp : public Engine, NEO::NonCopyableOrMovableClass {
     void init();
 
   private:
+    void initTelemetrySampling(OsSysman *pOsSysman);
     zes_engine_properties_t engineProperties = {};
+    TelemetrySampler *pTelemetrySampler = nullptr;
+    std::shared_ptr<const TelemetryHistory> pActivityHistory;
 };
 } // namespace Sysman
 } // namespace L0
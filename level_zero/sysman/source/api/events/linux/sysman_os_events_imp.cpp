@@ -118,6 +118,7 @@ void LinuxEventsUtil::eventRegister(zes_event_type_flags_t events, SysmanDeviceI
         } else {
             deviceEventsMap.emplace(pSysmanDevice, events);
         }
+        deviceToDevPathMap.erase(pSysmanDevice);
     } else {
         zes_event_type_flags_t registeredEvents = 0;
         // supportedEventMask --> this mask checks for events that supported currently
@@ -262,38 +263,74 @@ bool LinuxEventsUtil::checkIfFabricPortStatusChanged(void *dev, zes_event_type_f
     return false;
 }
 
+bool LinuxEventsUtil::getDevPath(SysmanDeviceImp *pSysmanDevice, std::string &devPath) {
+    // Real path of the device does not change while it is enumerated, so it is resolved once per device
+    auto it = deviceToDevPathMap.find(pSysmanDevice);
+    if (it != deviceToDevPathMap.end()) {
+        devPath = it->second;
+        return true;
+    }
+
+    std::string bdf;
+    auto pSysfsAccess = &static_cast<L0::Sysman::LinuxSysmanImp *>(pSysmanDevice->deviceGetOsInterface())->getSysfsAccess();
+    if (pSysfsAccess->getRealPath("device", bdf) != ZE_RESULT_SUCCESS) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr,
+                              "%s", "Failed to get real path of device\n");
+        return false;
+    }
+
+    // /sys needs to be removed from real path inorder to equate with
+    // DEVPATH property of uevent.
+    // Example of real path: /sys/devices/pci0000:97/0000:97:02.0/0000:98:00.0/0000:99:01.0/0000:9a:00.0
+    // Example of DEVPATH: /devices/pci0000:97/0000:97:02.0/0000:98:00.0/0000:99:01.0/0000:9a:00.0/i915.iaf.0
+    const auto loc = bdf.find("/devices");
+    if (loc == std::string::npos) {
+        NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr,
+                              "%s", "Invalid device path\n");
+        return false;
+    }
+
+    devPath = bdf.substr(loc);
+    deviceToDevPathMap.emplace(pSysmanDevice, devPath);
+    return true;
+}
+
 void LinuxEventsUtil::getDevIndexToDevPathMap(std::vector<zes_event_type_flags_t> &registeredEvents, uint32_t count, zes_device_handle_t *phDevices, std::map<uint32_t, std::string> &mapOfDevIndexToDevPath) {
     for (uint32_t devIndex = 0; devIndex < count; devIndex++) {
         auto device = static_cast<SysmanDeviceImp *>(L0::Sysman::SysmanDevice::fromHandle(phDevices[devIndex]));
         registeredEvents[devIndex] = deviceEventsMap[device];
         if (!registeredEvents[devIndex]) {
             continue;
-        } else {
-            std::string bdf;
-            auto pSysfsAccess = &static_cast<L0::Sysman::LinuxSysmanImp *>(device->deviceGetOsInterface())->getSysfsAccess();
-            if (pSysfsAccess->getRealPath("device", bdf) == ZE_RESULT_SUCCESS) {
-                // /sys needs to be removed from real path inorder to equate with
-                // DEVPATH property of uevent.
-                // Example of real path: /sys/devices/pci0000:97/0000:97:02.0/0000:98:00.0/0000:99:01.0/0000:9a:00.0
-                // Example of DEVPATH: /devices/pci0000:97/0000:97:02.0/0000:98:00.0/0000:99:01.0/0000:9a:00.0/i915.iaf.0
-                const auto loc = bdf.find("/devices");
-                if (loc == std::string::npos) {
-                    NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr,
-                                          "%s", "Invalid device path\n");
-                    continue;
-                }
+        }
+        std::string devPath;
+        if (getDevPath(device, devPath)) {
+            mapOfDevIndexToDevPath.insert({devIndex, devPath});
+        }
+    }
+}
 
-                bdf = bdf.substr(loc);
-                mapOfDevIndexToDevPath.insert({devIndex, bdf});
-            } else {
-                NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr,
-                                      "%s", "Failed to get real path of device\n");
-            }
+void LinuxEventsUtil::removeDetachedDevicePaths(zes_event_type_flags_t *pEvents, uint32_t count, zes_device_handle_t *phDevices) {
+    // Path of detached device is resolved again once it is attached
+    eventsMutex.lock();
+    for (uint32_t devIndex = 0; devIndex < count; devIndex++) {
+        if (pEvents[devIndex] & ZES_EVENT_TYPE_FLAG_DEVICE_DETACH) {
+            deviceToDevPathMap.erase(static_cast<SysmanDeviceImp *>(L0::Sysman::SysmanDevice::fromHandle(phDevices[devIndex])));
         }
     }
+    eventsMutex.unlock();
 }
 
-bool LinuxEventsUtil::checkDeviceEvents(std::vector<zes_event_type_flags_t> &registeredEvents, std::map<uint32_t, std::string> mapOfDevIndexToDevPath, zes_event_type_flags_t *pEvents, void *dev) {
+bool LinuxEventsUtil::getRemainingTimeout(uint64_t timeout, SteadyClock::time_point start, uint64_t &remainingTimeout) {
+    // Remaining time is always measured against the start of the listen, so it does not drift across wakeups
+    std::chrono::duration<double, std::milli> timeElapsed = L0::Sysman::SteadyClock::now() - start;
+    if (timeout <= timeElapsed.count()) {
+        return false;
+    }
+    remainingTimeout = timeout - static_cast<uint64_t>(timeElapsed.count());
+    return true;
+}
+
+bool LinuxEventsUtil::checkDeviceEvents(std::vector<zes_event_type_flags_t> &registeredEvents, const std::map<uint32_t, std::string> &mapOfDevIndexToDevPath, zes_event_type_flags_t *pEvents, void *dev) {
     const char *devicePath = pUdevLib->getEventPropertyValue(dev, "DEVPATH");
     bool retVal = false;
     if (devicePath != nullptr) {
@@ -348,9 +385,13 @@ bool LinuxEventsUtil::listenSystemEvents(zes_event_type_flags_t *pEvents, uint32
         return retval;
     }
 
-    subsystemList.push_back("drm");
-    subsystemList.push_back("auxiliary");
-    pfd[0].fd = pUdevLib->registerEventsFromSubsystemAndGetFd(subsystemList);
+    // Udev monitor keeps its subsystem filters and socket across listens, so it is registered only once
+    if (udevMonitorFd < 0) {
+        subsystemList.push_back("drm");
+        subsystemList.push_back("auxiliary");
+        udevMonitorFd = pUdevLib->registerEventsFromSubsystemAndGetFd(subsystemList);
+    }
+    pfd[0].fd = udevMonitorFd;
     pfd[0].events = POLLIN;
     pfd[0].revents = 0;
 
@@ -365,10 +406,10 @@ bool LinuxEventsUtil::listenSystemEvents(zes_event_type_flags_t *pEvents, uint32
     pfd[1].revents = 0;
 
     auto start = L0::Sysman::SteadyClock::now();
-    std::chrono::duration<double, std::milli> timeElapsed;
+    uint64_t remainingTimeout = timeout;
     getDevIndexToDevPathMap(registeredEvents, count, phDevices, mapOfDevIndexToDevPath);
     eventsMutex.unlock();
-    while (NEO::SysCalls::poll(pfd, 2, static_cast<int>(timeout)) > 0) {
+    while (NEO::SysCalls::poll(pfd, 2, static_cast<int>(remainingTimeout)) > 0) {
         bool eventReceived = false;
         for (auto i = 0; i < 2; i++) {
             if (pfd[i].revents != 0) {
@@ -390,25 +431,19 @@ bool LinuxEventsUtil::listenSystemEvents(zes_event_type_flags_t *pEvents, uint32
         }
 
         if (!eventReceived) {
-            timeElapsed = L0::Sysman::SteadyClock::now() - start;
-            if (timeout > timeElapsed.count()) {
-                timeout = timeout - timeElapsed.count();
+            if (getRemainingTimeout(timeout, start, remainingTimeout)) {
                 continue;
-            } else {
-                break;
             }
+            break;
         }
 
         void *dev = nullptr;
         dev = pUdevLib->allocateDeviceToReceiveData();
         if (dev == nullptr) {
-            timeElapsed = L0::Sysman::SteadyClock::now() - start;
-            if (timeout > timeElapsed.count()) {
-                timeout = timeout - timeElapsed.count();
+            if (getRemainingTimeout(timeout, start, remainingTimeout)) {
                 continue;
-            } else {
-                break;
             }
+            break;
         }
 
         auto eventTypePtr = pUdevLib->getEventType(dev);
@@ -421,15 +456,13 @@ bool LinuxEventsUtil::listenSystemEvents(zes_event_type_flags_t *pEvents, uint32
         retval = checkDeviceEvents(registeredEvents, mapOfDevIndexToDevPath, pEvents, dev);
         pUdevLib->dropDeviceReference(dev);
         if (retval) {
+            removeDetachedDevicePaths(pEvents, count, phDevices);
             break;
         }
-        timeElapsed = L0::Sysman::SteadyClock::now() - start;
-        if (timeout > timeElapsed.count()) {
-            timeout = timeout - timeElapsed.count();
+        if (getRemainingTimeout(timeout, start, remainingTimeout)) {
             continue;
-        } else {
-            break;
         }
+        break;
     }
 
     eventsMutex.lock();
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,7 +41,9 @@ class LinuxEventsUtil {
     UdevLib *pUdevLib = nullptr;
     LinuxSysmanDriverImp *pLinuxSysmanDriverImp = nullptr;
     int pipeFd[2] = {-1, -1};
+    int udevMonitorFd = -1;
     std::map<SysmanDeviceImp *, zes_event_type_flags_t> deviceEventsMap;
+    std::map<SysmanDeviceImp *, std::string> deviceToDevPathMap;
     bool checkRasEvent(zes_event_type_flags_t &pEvent, SysmanDeviceImp *pSysmanDeviceImp, zes_event_type_flags_t registeredEvents);
     bool isResetRequired(void *dev, zes_event_type_flags_t &pEvent);
     bool checkDeviceDetachEvent(zes_event_type_flags_t &pEvent);
@@ -58,8 +60,11 @@ class LinuxEventsUtil {
     static const std::string unbind;
     static const std::string bind;
     static bool checkRasEventOccured(Ras *rasHandle);
+    static bool getRemainingTimeout(uint64_t timeout, SteadyClock::time_point start, uint64_t &remainingTimeout);
+    bool getDevPath(SysmanDeviceImp *pSysmanDevice, std::string &devPath);
+    void removeDetachedDevicePaths(zes_event_type_flags_t *pEvents, uint32_t count, zes_device_handle_t *phDevices);
     void getDevIndexToDevPathMap(std::vector<zes_event_type_flags_t> &registeredEvents, uint32_t count, zes_device_handle_t *phDevices, std::map<uint32_t, std::string> &mapOfDevIndexToDevPath);
-    bool checkDeviceEvents(std::vector<zes_event_type_flags_t> &registeredEvents, std::map<uint32_t, std::string> mapOfDevIndexToDevPath, zes_event_type_flags_t *pEvents, void *dev);
+    bool checkDeviceEvents(std::vector<zes_event_type_flags_t> &registeredEvents, const std::map<uint32_t, std::string> &mapOfDevIndexToDevPath, zes_event_type_flags_t *pEvents, void *dev);
     std::once_flag initEventsOnce;
     std::mutex eventsMutex;
     void init();
@@ -11,6 +11,7 @@
 
 #include "level_zero/sysman/source/api/power/sysman_os_power.h"
 #include "level_zero/sysman/source/device/sysman_device_imp.h"
+#include "level_zero/sysman/source/device/sysman_telemetry_sampler.h"
 
 namespace L0 {
 namespace Sysman {
@@ -37,6 +38,12 @@ ze_result_t PowerImp::powerGetProperties(zes_power_properties_t *pProperties) {
 }
 
 ze_result_t PowerImp::powerGetEnergyCounter(zes_power_energy_counter_t *pEnergy) {
+    TelemetrySample sample;
+    if (pEnergyHistory != nullptr && pEnergyHistory->getLatest(sample)) {
+        pEnergy->energy = sample.values[0];
+        pEnergy->timestamp = sample.values[1];
+        return ZE_RESULT_SUCCESS;
+    }
     return pOsPower->getEnergyCounter(pEnergy);
 }
 
@@ -70,6 +77,23 @@ PowerImp::PowerImp(OsSysman *pOsSysman, ze_bool_t isSubDevice, uint32_t subDevic
     UNRECOVERABLE_IF(nullptr == pOsPower);
     this->isCardPower = isSubDevice ? false : true;
     init();
+    if (this->initSuccess) {
+        initTelemetrySampling(pOsSysman);
+    }
+}
+
+void PowerImp::initTelemetrySampling(OsSysman *pOsSysman) {
+    pTelemetrySampler = pOsSysman->getTelemetrySampler();
+    if (pTelemetrySampler == nullptr) {
+        return;
+    }
+    pEnergyHistory = pTelemetrySampler->addSource([this](TelemetrySample &sample) {
+        zes_power_energy_counter_t energy = {};
+        auto result = pOsPower->getEnergyCounter(&energy);
+        sample.values[0] = energy.energy;
+        sample.values[1] = energy.timestamp;
+        return result;
+    });
 }
 
 void PowerImp::init() {
@@ -79,6 +103,9 @@ void PowerImp::init() {
 }
 
 PowerImp::~PowerImp() {
+    if (pTelemetrySampler != nullptr) {
+        pTelemetrySampler->removeSource(pEnergyHistory.get());
+    }
     if (nullptr != pOsPower) {
         delete pOsPower;
         pOsPower = nullptr;
@@ -11,9 +11,13 @@
 
 #include "level_zero/sysman/source/api/power/sysman_power.h"
 
+#include <memory>
+
 namespace L0 {
 namespace Sysman {
 class OsPower;
+class TelemetryHistory;
+class TelemetrySampler;
 class PowerImp : public Power, NEO::NonCopyableOrMovableClass {
   public:
     ze_result_t powerGetProperties(zes_power_properties_t *pProperties) override;
@@ -31,6 +35,11 @@ class PowerImp : public Power, NEO::NonCopyableOrMovableClass {
 
     OsPower *pOsPower = nullptr;
     void init();
+
+  private:
+    void initTelemetrySampling(OsSysman *pOsSysman);
+    TelemetrySampler *pTelemetrySampler = nullptr;
+    std::shared_ptr<const TelemetryHistory> pEnergyHistory;
 };
 } // namespace Sysman
 } // namespace L0
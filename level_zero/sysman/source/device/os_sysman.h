@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,20 +10,28 @@
 
 #include <level_zero/zes_api.h>
 
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace L0 {
 namespace Sysman {
 
 struct SysmanDeviceImp;
+class TelemetrySampler;
 
 struct OsSysman {
-    virtual ~OsSysman(){};
+    virtual ~OsSysman();
 
     virtual ze_result_t init() = 0;
     static OsSysman *create(SysmanDeviceImp *pSysmanImp);
     virtual uint32_t getSubDeviceCount() = 0;
     virtual const NEO::HardwareInfo &getHardwareInfo() const = 0;
+    TelemetrySampler *getTelemetrySampler();
+
+  protected:
+    std::once_flag telemetrySamplerCreated;
+    std::unique_ptr<TelemetrySampler> pTelemetrySampler;
 };
 
 } // namespace Sysman
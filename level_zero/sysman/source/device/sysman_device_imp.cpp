@@ -15,12 +15,22 @@
 #include "level_zero/sysman/source/api/global_operations/sysman_global_operations_imp.h"
 #include "level_zero/sysman/source/api/pci/sysman_pci_imp.h"
 #include "level_zero/sysman/source/device/os_sysman.h"
+#include "level_zero/sysman/source/device/sysman_telemetry_sampler.h"
 
 #include <vector>
 
 namespace L0 {
 namespace Sysman {
 
+OsSysman::~OsSysman() = default;
+
+TelemetrySampler *OsSysman::getTelemetrySampler() {
+    std::call_once(telemetrySamplerCreated, [this]() {
+        pTelemetrySampler = TelemetrySampler::create();
+    });
+    return pTelemetrySampler.get();
+}
+
 SysmanDeviceImp::SysmanDeviceImp(NEO::ExecutionEnvironment *executionEnvironment, const uint32_t rootDeviceIndex)
     : executionEnvironment(executionEnvironment), rootDeviceIndex(rootDeviceIndex) {
     this->executionEnvironment->incRefInternal();
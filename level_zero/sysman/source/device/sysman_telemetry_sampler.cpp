@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/sysman/source/device/sysman_telemetry_sampler.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace L0 {
+namespace Sysman {
+
+void TelemetryHistory::push(const TelemetrySample &sample) {
+    const auto index = writeCount.load(std::memory_order_relaxed);
+    auto &slot = slots[index % capacity];
+
+    const auto sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.sampleTime.store(sample.sampleTime, std::memory_order_relaxed);
+    for (size_t i = 0; i < slot.values.size(); i++) {
+        slot.values[i].store(sample.values[i], std::memory_order_relaxed);
+    }
+
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+    writeCount.store(index + 1, std::memory_order_release);
+}
+
+bool TelemetryHistory::readSlot(uint64_t index, TelemetrySample &sample) const {
+    const auto &slot = slots[index % capacity];
+    while (true) {
+        const auto sequenceBefore = slot.sequence.load(std::memory_order_acquire);
+        if (sequenceBefore & 1u) {
+            continue;
+        }
+
+        sample.sampleTime = slot.sampleTime.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < slot.values.size(); i++) {
+            sample.values[i] = slot.values[i].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) == sequenceBefore) {
+            return true;
+        }
+    }
+}
+
+bool TelemetryHistory::getLatest(TelemetrySample &sample) const {
+    const auto count = writeCount.load(std::memory_order_acquire);
+    if (count == 0) {
+        return false;
+    }
+    return readSlot(count - 1, sample);
+}
+
+void TelemetryHistory::getSamples(uint64_t minSampleTime, std::vector<TelemetrySample> &samples) const {
+    samples.clear();
+    const auto count = writeCount.load(std::memory_order_acquire);
+    const auto available = std::min<uint64_t>(count, capacity);
+
+    TelemetrySample sample;
+    uint64_t previousSampleTime = UINT64_MAX;
+    for (uint64_t i = 0; i < available; i++) {
+        readSlot(count - 1 - i, sample);
+        // Slot could be overwritten with newer sample meanwhile, which ends ordered part of history
+        if (sample.sampleTime < minSampleTime || sample.sampleTime > previousSampleTime) {
+            break;
+        }
+        previousSampleTime = sample.sampleTime;
+        samples.push_back(sample);
+    }
+}
+
+bool TelemetryHistory::getWindowStatistics(uint64_t minSampleTime, uint32_t valueIndex, uint64_t &average, uint64_t &max) const {
+    DEBUG_BREAK_IF(valueIndex >= slots[0].values.size());
+    std::vector<TelemetrySample> samples;
+    getSamples(minSampleTime, samples);
+    if (samples.empty()) {
+        return false;
+    }
+
+    uint64_t sum = 0;
+    max = 0;
+    for (const auto &sample : samples) {
+        sum += sample.values[valueIndex];
+        max = std::max(max, sample.values[valueIndex]);
+    }
+    average = sum / samples.size();
+    return true;
+}
+
+std::unique_ptr<TelemetrySampler> TelemetrySampler::create() {
+    const auto samplingIntervalMs = NEO::debugManager.flags.SysmanTelemetrySamplingIntervalMs.get();
+    if (samplingIntervalMs <= 0) {
+        return nullptr;
+    }
+    auto sampler = std::make_unique<TelemetrySampler>(static_cast<uint32_t>(samplingIntervalMs));
+    sampler->start();
+    return sampler;
+}
+
+TelemetrySampler::TelemetrySampler(uint32_t samplingIntervalMs)
+    : samplingIntervalMs(samplingIntervalMs),
+      samplingTask([this]() { this->collectSamples(); }, std::chrono::milliseconds(samplingIntervalMs)) {}
+
+TelemetrySampler::~TelemetrySampler() {
+    stop();
+}
+
+uint64_t TelemetrySampler::getCurrentTimeUs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+std::shared_ptr<const TelemetryHistory> TelemetrySampler::addSource(SampleFunction sampleFunction) {
+    auto history = std::make_shared<TelemetryHistory>();
+    std::lock_guard<std::mutex> lock(sourcesMutex);
+    sources.push_back({std::move(sampleFunction), history});
+    return history;
+}
+
+void TelemetrySampler::removeSource(const TelemetryHistory *history) {
+    // Taking the lock waits for sampling round in progress, so sample function is not called after return
+    std::lock_guard<std::mutex> lock(sourcesMutex);
+    sources.erase(std::remove_if(sources.begin(), sources.end(), [history](const Source &source) {
+                      return source.history.get() == history;
+                  }),
+                  sources.end());
+}
+
+void TelemetrySampler::collectSamples() {
+    const auto roundStart = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(sourcesMutex);
+        for (auto &source : sources) {
+            TelemetrySample sample;
+            if (source.sampleFunction(sample) != ZE_RESULT_SUCCESS) {
+                sampleFailures++;
+                continue;
+            }
+            sample.sampleTime = getCurrentTimeUs();
+            source.history->push(sample);
+            samplesCollected++;
+        }
+    }
+    samplingRounds++;
+    samplingTimeNs += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - roundStart).count());
+}
+
+void TelemetrySampler::start() {
+    samplingTask.start();
+}
+
+void TelemetrySampler::stop() {
+    samplingTask.stop();
+}
+
+TelemetrySampler::Statistics TelemetrySampler::getStatistics() const {
+    Statistics statistics;
+    statistics.samplingRounds = samplingRounds.load();
+    statistics.samplesCollected = samplesCollected.load();
+    statistics.sampleFailures = sampleFailures.load();
+    statistics.samplingTimeNs = samplingTimeNs.load();
+    return statistics;
+}
+
+} // namespace Sysman
+} // namespace L0
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/periodic_task.h"
+
+#include <level_zero/zes_api.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace L0 {
+namespace Sysman {
+
+struct TelemetrySample {
+    uint64_t sampleTime = 0; // microseconds of sampler clock
+    uint64_t values[2] = {};
+};
+
+// Ring of recent samples written only by the sampler thread. Every slot is guarded by its own sequence
+// counter (odd while slot is written), so readers never take a lock and only retry on torn reads.
+class TelemetryHistory : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t capacity = 64;
+
+    void push(const TelemetrySample &sample);
+    bool getLatest(TelemetrySample &sample) const;
+    // Returns samples not older than minSampleTime, newest first
+    void getSamples(uint64_t minSampleTime, std::vector<TelemetrySample> &samples) const;
+    bool getWindowStatistics(uint64_t minSampleTime, uint32_t valueIndex, uint64_t &average, uint64_t &max) const;
+    uint64_t getSampleCount() const { return writeCount.load(std::memory_order_acquire); }
+
+  protected:
+    struct Slot {
+        std::atomic<uint32_t> sequence{0};
+        std::atomic<uint64_t> sampleTime{0};
+        std::array<std::atomic<uint64_t>, 2> values{};
+    };
+
+    bool readSlot(uint64_t index, TelemetrySample &sample) const;
+
+    std::array<Slot, capacity> slots;
+    std::atomic<uint64_t> writeCount{0};
+};
+
+// Optional per device thread, which periodically collects registered telemetry into histories,
+// so getters can return latest sample instead of reading from kernel on the caller's thread.
+class TelemetrySampler : NEO::NonCopyableOrMovableClass {
+  public:
+    using SampleFunction = std::function<ze_result_t(TelemetrySample &sample)>;
+
+    struct Statistics {
+        uint64_t samplingRounds = 0;
+        uint64_t samplesCollected = 0;
+        uint64_t sampleFailures = 0;
+        uint64_t samplingTimeNs = 0;
+    };
+
+    static std::unique_ptr<TelemetrySampler> create();
+
+    TelemetrySampler(uint32_t samplingIntervalMs);
+    ~TelemetrySampler();
+
+    std::shared_ptr<const TelemetryHistory> addSource(SampleFunction sampleFunction);
+    void removeSource(const TelemetryHistory *history);
+    void collectSamples();
+    void start();
+    void stop();
+    Statistics getStatistics() const;
+    uint32_t getSamplingIntervalMs() const { return samplingIntervalMs; }
+
+  protected:
+    struct Source {
+        SampleFunction sampleFunction;
+        std::shared_ptr<TelemetryHistory> history;
+    };
+
+    static uint64_t getCurrentTimeUs();
+
+    const uint32_t samplingIntervalMs;
+    std::mutex sourcesMutex;
+    std::vector<Source> sources;
+
+    std::atomic<uint64_t> samplingRounds{0};
+    std::atomic<uint64_t> samplesCollected{0};
+    std::atomic<uint64_t> sampleFailures{0};
+    std::atomic<uint64_t> samplingTimeNs{0};
+
+    NEO::PeriodicTask samplingTask;
+};
+
+} // namespace Sysman
+} // namespace L0
@@ -97,6 +97,10 @@ std::string SysmanKmdInterfaceI915Prelim::getSysfsFilePathForPhysicalMemorySize(
 }
 
 int64_t SysmanKmdInterfaceI915Prelim::getEngineActivityFd(zes_engine_group_t engineGroup, uint32_t engineInstance, uint32_t subDeviceId, PmuInterface *const &pPmuInterface) {
+    return pPmuInterface->pmuInterfaceOpen(getEngineActivityConfig(engineGroup, engineInstance, subDeviceId), -1, PERF_FORMAT_TOTAL_TIME_ENABLED);
+}
+
+uint64_t SysmanKmdInterfaceI915Prelim::getEngineActivityConfig(zes_engine_group_t engineGroup, uint32_t engineInstance, uint32_t subDeviceId) {
     uint64_t config = UINT64_MAX;
     switch (engineGroup) {
     case ZES_ENGINE_GROUP_ALL:
@@ -117,7 +121,7 @@ int64_t SysmanKmdInterfaceI915Prelim::getEngineActivityFd(zes_engine_group_t eng
         config = I915_PMU_ENGINE_BUSY(engineClass->second, engineInstance);
         break;
     }
-    return pPmuInterface->pmuInterfaceOpen(config, -1, PERF_FORMAT_TOTAL_TIME_ENABLED);
+    return config;
 }
 
 std::string SysmanKmdInterfaceI915Prelim::getHwmonName(uint32_t subDeviceId, bool isSubdevice) const {
@@ -90,10 +90,15 @@ std::string SysmanKmdInterfaceI915Upstream::getSysfsFilePathForPhysicalMemorySiz
 }
 
 int64_t SysmanKmdInterfaceI915Upstream::getEngineActivityFd(zes_engine_group_t engineGroup, uint32_t engineInstance, uint32_t subDeviceId, PmuInterface *const &pPmuInterface) {
-    uint64_t config = UINT64_MAX;
+    return pPmuInterface->pmuInterfaceOpen(getEngineActivityConfig(engineGroup, engineInstance, subDeviceId), -1, PERF_FORMAT_TOTAL_TIME_ENABLED);
+}
+
+uint64_t SysmanKmdInterfaceI915Upstream::getEngineActivityConfig(zes_engine_group_t engineGroup, uint32_t engineInstance, uint32_t subDeviceId) {
     auto engineClass = engineGroupToEngineClass.find(engineGroup);
-    config = I915_PMU_ENGINE_BUSY(engineClass->second, engineInstance);
-    return pPmuInterface->pmuInterfaceOpen(config, -1, PERF_FORMAT_TOTAL_TIME_ENABLED);
+    if (engineClass == engineGroupToEngineClass.end()) {
+        return UINT64_MAX;
+    }
+    return I915_PMU_ENGINE_BUSY(engineClass->second, engineInstance);
 }
 
 std::string SysmanKmdInterfaceI915Upstream::getHwmonName(uint32_t subDeviceId, bool isSubdevice) const {
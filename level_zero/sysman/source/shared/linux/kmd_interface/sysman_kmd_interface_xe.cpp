@@ -95,8 +95,11 @@ std::string SysmanKmdInterfaceXe::getSysfsFilePathForPhysicalMemorySize(uint32_t
 }
 
 int64_t SysmanKmdInterfaceXe::getEngineActivityFd(zes_engine_group_t engineGroup, uint32_t engineInstance, uint32_t subDeviceId, PmuInterface *const &pPmuInterface) {
-    uint64_t config = getPmuEngineConfig(engineGroup, engineInstance, subDeviceId);
-    return pPmuInterface->pmuInterfaceOpen(config, -1, PERF_FORMAT_TOTAL_TIME_ENABLED);
+    return pPmuInterface->pmuInterfaceOpen(getEngineActivityConfig(engineGroup, engineInstance, subDeviceId), -1, PERF_FORMAT_TOTAL_TIME_ENABLED);
+}
+
+uint64_t SysmanKmdInterfaceXe::getEngineActivityConfig(zes_engine_group_t engineGroup, uint32_t engineInstance, uint32_t subDeviceId) {
+    return getPmuEngineConfig(engineGroup, engineInstance, subDeviceId);
 }
 
 std::string SysmanKmdInterfaceXe::getHwmonName(uint32_t subDeviceId, bool isSubdevice) const {
@@ -8,7 +8,7 @@
 #include "level_zero/sysman/source/shared/linux/pmt/sysman_pmt.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
-#include "shared/source/os_interface/linux/file_descriptor.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/os_interface/linux/pmt_util.h"
 
 #include "level_zero/sysman/source/device/sysman_device_imp.h"
@@ -32,37 +32,83 @@ std::string PlatformMonitoringTech::getGuid() {
 }
 
 ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint32_t &value) {
+    return readKey(key, &value, sizeof(uint32_t));
+}
+
+ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint64_t &value) {
+    return readKey(key, &value, sizeof(uint64_t));
+}
+
+ze_result_t PlatformMonitoringTech::readKey(const std::string &key, void *value, size_t size) {
     auto offset = keyOffsetMap.find(key);
     if (offset == keyOffsetMap.end()) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
-    auto fd = NEO::FileDescriptor(telemetryDeviceEntry.c_str(), O_RDONLY);
+
+    std::lock_guard<std::mutex> lock(telemetryMutex);
+    if (snapshotValidity.count() > 0) {
+        return readKeyFromSnapshot(offset->second, value, size);
+    }
+
+    auto fd = getTelemetryFd();
     if (fd == -1) {
         return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
     }
 
-    ze_result_t res = ZE_RESULT_SUCCESS;
-    if (this->preadFunction(fd, &value, sizeof(uint32_t), baseOffset + offset->second) != sizeof(uint32_t)) {
-        res = ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+    if (this->preadFunction(fd, value, size, baseOffset + offset->second) != static_cast<ssize_t>(size)) {
+        closeTelemetryFd();
+        return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
     }
-    return res;
+    return ZE_RESULT_SUCCESS;
 }
 
-ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint64_t &value) {
-    auto offset = keyOffsetMap.find(key);
-    if (offset == keyOffsetMap.end()) {
-        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+// Whole region spanned by known keys is read with a single pread and
+// all keys are served from it until snapshot validity expires.
+ze_result_t PlatformMonitoringTech::readKeyFromSnapshot(uint64_t keyOffset, void *value, size_t size) {
+    auto now = std::chrono::steady_clock::now();
+    if (snapshot.empty() || (now - snapshotTime) > snapshotValidity) {
+        auto fd = getTelemetryFd();
+        if (fd == -1) {
+            return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+        }
+
+        auto minMaxOffsets = std::minmax_element(keyOffsetMap.begin(), keyOffsetMap.end(), [](const auto &lhs, const auto &rhs) {
+            return lhs.second < rhs.second;
+        });
+        snapshotBeginOffset = minMaxOffsets.first->second;
+        snapshot.resize(static_cast<size_t>(minMaxOffsets.second->second - snapshotBeginOffset) + sizeof(uint64_t));
+
+        auto bytesRead = this->preadFunction(fd, snapshot.data(), snapshot.size(), baseOffset + snapshotBeginOffset);
+        if (bytesRead <= 0) {
+            snapshot.clear();
+            closeTelemetryFd();
+            return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+        }
+        // Last key may be 32 bit wide and end the telemetry region
+        snapshot.resize(static_cast<size_t>(bytesRead));
+        snapshotTime = now;
     }
-    auto fd = NEO::FileDescriptor(telemetryDeviceEntry.c_str(), O_RDONLY);
-    if (fd == -1) {
+
+    auto offsetInSnapshot = keyOffset - snapshotBeginOffset;
+    if (offsetInSnapshot + size > snapshot.size()) {
         return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
     }
+    memcpy_s(value, size, snapshot.data() + offsetInSnapshot, size);
+    return ZE_RESULT_SUCCESS;
+}
+
+int PlatformMonitoringTech::getTelemetryFd() {
+    if (telemetryFd == -1) {
+        telemetryFd = NEO::SysCalls::open(telemetryDeviceEntry.c_str(), O_RDONLY);
+    }
+    return telemetryFd;
+}
 
-    ze_result_t res = ZE_RESULT_SUCCESS;
-    if (this->preadFunction(fd, &value, sizeof(uint64_t), baseOffset + offset->second) != sizeof(uint64_t)) {
-        res = ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+void PlatformMonitoringTech::closeTelemetryFd() {
+    if (telemetryFd != -1) {
+        NEO::SysCalls::close(telemetryFd);
+        telemetryFd = -1;
     }
-    return res;
 }
 
 bool compareTelemNodes(std::string &telemNode1, std::string &telemNode2) {
@@ -177,6 +223,9 @@ ze_result_t PlatformMonitoringTech::init(LinuxSysmanImp *pLinuxSysmanImp, const
 
 PlatformMonitoringTech::PlatformMonitoringTech(FsAccessInterface *pFsAccess, ze_bool_t onSubdevice,
                                                uint32_t subdeviceId) : subdeviceId(subdeviceId), isSubdevice(onSubdevice) {
+    if (NEO::debugManager.flags.SysmanPmtSnapshotValidityMs.get() > 0) {
+        snapshotValidity = std::chrono::milliseconds(NEO::debugManager.flags.SysmanPmtSnapshotValidityMs.get());
+    }
 }
 
 void PlatformMonitoringTech::doInitPmtObject(LinuxSysmanImp *pLinuxSysmanImp, uint32_t subdeviceId, PlatformMonitoringTech *pPmt, const std::string &gpuUpstreamPortPath,
@@ -249,6 +298,7 @@ bool PlatformMonitoringTech::getTelemOffsetForContainer(SysmanProductHelper *pSy
 }
 
 PlatformMonitoringTech::~PlatformMonitoringTech() {
+    closeTelemetryFd();
 }
 
 } // namespace Sysman
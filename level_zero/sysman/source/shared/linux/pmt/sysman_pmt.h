@@ -11,10 +11,13 @@
 
 #include "level_zero/zes_api.h"
 
+#include <chrono>
 #include <fcntl.h>
 #include <map>
+#include <mutex>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <vector>
 
 namespace L0 {
 namespace Sysman {
@@ -46,8 +49,20 @@ class PlatformMonitoringTech : NEO::NonCopyableOrMovableClass {
     ze_result_t init(LinuxSysmanImp *pLinuxSysmanImp, const std::string &gpuUpstreamPortPath);
     static void doInitPmtObject(LinuxSysmanImp *pLinuxSysmanImp, uint32_t subdeviceId, PlatformMonitoringTech *pPmt, const std::string &gpuUpstreamPortPath,
                                 std::map<uint32_t, L0::Sysman::PlatformMonitoringTech *> &mapOfSubDeviceIdToPmtObject);
+    ze_result_t readKey(const std::string &key, void *value, size_t size);
+    ze_result_t readKeyFromSnapshot(uint64_t keyOffset, void *value, size_t size);
+    int getTelemetryFd();
+    void closeTelemetryFd();
     decltype(&NEO::SysCalls::pread) preadFunction = NEO::SysCalls::pread;
 
+    // Telemetry file is kept open between reads, it is reopened after a failed read.
+    int telemetryFd = -1;
+    std::mutex telemetryMutex;
+    std::chrono::milliseconds snapshotValidity{0};
+    std::chrono::steady_clock::time_point snapshotTime{};
+    std::vector<uint8_t> snapshot;
+    uint64_t snapshotBeginOffset = 0;
+
   private:
     static const std::string baseTelemSysFS;
     static const std::string telem;
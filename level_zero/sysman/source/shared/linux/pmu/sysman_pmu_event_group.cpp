@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/sysman/source/shared/linux/pmu/sysman_pmu_event_group.h"
+
+#include "shared/source/os_interface/linux/sys_calls.h"
+
+#include "level_zero/sysman/source/shared/linux/pmu/sysman_pmu.h"
+
+#include <algorithm>
+#include <linux/perf_event.h>
+
+namespace L0 {
+namespace Sysman {
+
+static constexpr uint32_t groupReadHeaderSize = 2;
+
+PmuEventGroup::PmuEventGroup(PmuInterface *pPmuInterface) : pPmuInterface(pPmuInterface) {}
+
+PmuEventGroup::~PmuEventGroup() {
+    // Close members before the leader
+    for (auto it = fds.rbegin(); it != fds.rend(); ++it) {
+        NEO::SysCalls::close(static_cast<int>(*it));
+    }
+}
+
+int32_t PmuEventGroup::addEvent(uint64_t config) {
+    std::lock_guard<std::mutex> lock(groupMutex);
+    const int groupFd = fds.empty() ? -1 : static_cast<int>(fds[0]);
+    auto fd = pPmuInterface->pmuInterfaceOpen(config, groupFd, PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_GROUP);
+    if (fd < 0) {
+        return -1;
+    }
+    fds.push_back(fd);
+    readData.resize(groupReadHeaderSize + fds.size());
+    valueConsumed.push_back(true);
+    dataValid = false;
+    return static_cast<int32_t>(fds.size() - 1);
+}
+
+int PmuEventGroup::readEvent(uint32_t index, uint64_t &value, uint64_t &timeEnabled) {
+    std::lock_guard<std::mutex> lock(groupMutex);
+    if (index >= fds.size()) {
+        return -1;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (!dataValid || valueConsumed[index] || (now - lastReadTime) > maxDataAge) {
+        auto ret = pPmuInterface->pmuRead(static_cast<int>(fds[0]), readData.data(), static_cast<ssize_t>(readData.size() * sizeof(uint64_t)));
+        if (ret < 0 || readData[0] != fds.size()) {
+            dataValid = false;
+            return -1;
+        }
+        std::fill(valueConsumed.begin(), valueConsumed.end(), false);
+        dataValid = true;
+        lastReadTime = now;
+    }
+
+    valueConsumed[index] = true;
+    timeEnabled = readData[1];
+    value = readData[groupReadHeaderSize + index];
+    return 0;
+}
+
+} // namespace Sysman
+} // namespace L0
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace L0 {
+namespace Sysman {
+class PmuInterface;
+
+// Perf events opened as single group, so values of all members are read with one read() call and share
+// enabled time. Group is read again once some member asks for a value it has already consumed or once
+// the last read is older than maxDataAge, so querying each member once in a row costs single syscall.
+class PmuEventGroup : NEO::NonCopyableOrMovableClass {
+  public:
+    PmuEventGroup(PmuInterface *pPmuInterface);
+    ~PmuEventGroup();
+
+    int32_t addEvent(uint64_t config);
+    int readEvent(uint32_t index, uint64_t &value, uint64_t &timeEnabled);
+    uint32_t getEventCount() const { return static_cast<uint32_t>(fds.size()); }
+    int64_t getEventFd(uint32_t index) const { return fds[index]; }
+
+  protected:
+    static constexpr std::chrono::milliseconds maxDataAge{10};
+
+    PmuInterface *pPmuInterface = nullptr;
+    // fds[0] is the group leader
+    std::vector<int64_t> fds;
+    // Group read format: number of events, enabled time and then value of each event
+    std::vector<uint64_t> readData;
+    std::vector<bool> valueConsumed;
+    bool dataValid = false;
+    std::chrono::steady_clock::time_point lastReadTime;
+    std::mutex groupMutex;
+};
+
+} // namespace Sysman
+} // namespace L0
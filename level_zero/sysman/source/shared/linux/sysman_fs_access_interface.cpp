@@ -7,6 +7,8 @@
 
 #include "level_zero/sysman/source/shared/linux/sysman_fs_access_interface.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
 #include "level_zero/sysman/source/shared/linux/zes_os_sysman_imp.h"
 
 #include <csignal>
@@ -20,61 +22,62 @@ namespace Sysman {
 
 FsAccessInterface::~FsAccessInterface() = default;
 
-void FdCacheInterface::eraseLeastUsedEntryFromCache() {
-    auto it = fdMap.begin();
-    uint32_t fdCountRef = it->second.second;
-    std::map<std::string, std::pair<int, uint32_t>>::iterator leastUsedIterator = it;
-    while (++it != fdMap.end()) {
-        if (it->second.second < fdCountRef) {
-            fdCountRef = it->second.second;
-            leastUsedIterator = it;
-        }
+FdCacheInterface::FdCacheInterface() {
+    if (NEO::debugManager.flags.SysmanFdCacheSize.get() > 0) {
+        capacity = static_cast<size_t>(NEO::debugManager.flags.SysmanFdCacheSize.get());
     }
-    NEO::SysCalls::close(leastUsedIterator->second.first);
-    fdMap.erase(leastUsedIterator);
+}
+
+void FdCacheInterface::eraseLeastRecentlyUsedEntryFromCache() {
+    auto &leastRecentlyUsed = fdList.back();
+    NEO::SysCalls::close(leastRecentlyUsed.second);
+    fdMap.erase(leastRecentlyUsed.first);
+    fdList.pop_back();
 }
 
 int FdCacheInterface::getFd(std::string file) {
-    int fd = -1;
-    if (fdMap.find(file) == fdMap.end()) {
-        fd = NEO::SysCalls::open(file.c_str(), O_RDONLY);
-        if (fd < 0) {
-            return -1;
-        }
-        if (fdMap.size() == maxSize) {
-            eraseLeastUsedEntryFromCache();
-        }
-        fdMap[file] = std::make_pair(fd, 1);
-    } else {
-        auto &fdPair = fdMap[file];
-        fdPair.second++;
+    auto it = fdMap.find(file);
+    if (it != fdMap.end()) {
+        fdList.splice(fdList.begin(), fdList, it->second);
+        return it->second->second;
+    }
+
+    int fd = NEO::SysCalls::open(file.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    if (fdList.size() == capacity) {
+        eraseLeastRecentlyUsedEntryFromCache();
     }
-    return fdMap[file].first;
+    fdList.emplace_front(file, fd);
+    fdMap[std::move(file)] = fdList.begin();
+    return fd;
 }
 
 FdCacheInterface::~FdCacheInterface() {
-    for (auto it = fdMap.begin(); it != fdMap.end(); ++it) {
-        NEO::SysCalls::close(it->second.first);
+    for (auto &entry : fdList) {
+        NEO::SysCalls::close(entry.second);
     }
     fdMap.clear();
+    fdList.clear();
 }
 
 template <typename T>
 ze_result_t FsAccessInterface::readValue(const std::string file, T &val) {
     auto lock = this->obtainMutex();
 
-    std::string readVal(64, '\0');
+    char readVal[64] = {};
     int fd = pFdCacheInterface->getFd(file);
     if (fd < 0) {
         return LinuxSysmanImp::getResult(errno);
     }
 
-    ssize_t bytesRead = NEO::SysCalls::pread(fd, readVal.data(), readVal.size(), 0);
+    ssize_t bytesRead = NEO::SysCalls::pread(fd, readVal, sizeof(readVal) - 1, 0);
     if (bytesRead < 0) {
         return LinuxSysmanImp::getResult(errno);
     }
 
-    std::istringstream stream(readVal);
+    std::istringstream stream(std::string(readVal, static_cast<size_t>(bytesRead)));
     stream >> val;
     if (stream.fail()) {
         return ZE_RESULT_ERROR_UNKNOWN;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,9 +11,12 @@
 
 #include <level_zero/zes_api.h>
 
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace L0 {
@@ -21,18 +24,24 @@ namespace Sysman {
 
 class FdCacheInterface {
   public:
-    FdCacheInterface() = default;
+    FdCacheInterface();
     ~FdCacheInterface();
 
-    static const int maxSize = 10;
+    static const int maxSize = 64;
     int getFd(std::string file);
+    size_t getCapacity() const { return capacity; }
 
   protected:
-    // Map of File name to pair of file descriptor and reference count to file.
-    std::map<std::string, std::pair<int, uint32_t>> fdMap = {};
+    using FdList = std::list<std::pair<std::string, int>>;
+
+    // Pairs of file name and file descriptor, most recently used entry first.
+    FdList fdList = {};
+    // Map of file name to its entry in fdList.
+    std::unordered_map<std::string, FdList::iterator> fdMap = {};
+    size_t capacity = maxSize;
 
   private:
-    void eraseLeastUsedEntryFromCache();
+    void eraseLeastRecentlyUsedEntryFromCache();
 };
 
 class FsAccessInterface {
@@ -23,6 +23,7 @@
 #include "level_zero/sysman/source/shared/linux/kmd_interface/sysman_kmd_interface.h"
 #include "level_zero/sysman/source/shared/linux/pmt/sysman_pmt.h"
 #include "level_zero/sysman/source/shared/linux/pmu/sysman_pmu.h"
+#include "level_zero/sysman/source/shared/linux/pmu/sysman_pmu_event_group.h"
 #include "level_zero/sysman/source/shared/linux/product_helper/sysman_product_helper.h"
 #include "level_zero/sysman/source/shared/linux/sysman_fs_access_interface.h"
 
@@ -223,6 +224,15 @@ void LinuxSysmanImp::releaseFwUtilInterface() {
     }
 }
 
+std::shared_ptr<PmuEventGroup> LinuxSysmanImp::getEngineActivityEventGroup() {
+    auto eventGroup = engineActivityEventGroup.lock();
+    if (eventGroup == nullptr) {
+        eventGroup = std::make_shared<PmuEventGroup>(pPmuInterface);
+        engineActivityEventGroup = eventGroup;
+    }
+    return eventGroup;
+}
+
 LinuxSysmanImp::~LinuxSysmanImp() {
     if (nullptr != pPmuInterface) {
         delete pPmuInterface;
@@ -17,6 +17,7 @@
 #include "level_zero/sysman/source/sysman_const.h"
 
 #include <map>
+#include <memory>
 #include <mutex>
 
 namespace NEO {
@@ -29,6 +30,7 @@ namespace Sysman {
 class SysmanProductHelper;
 class PlatformMonitoringTech;
 class PmuInterface;
+class PmuEventGroup;
 class FirmwareUtil;
 class SysmanKmdInterface;
 class FsAccessInterface;
@@ -44,6 +46,7 @@ class LinuxSysmanImp : public OsSysman, NEO::NonCopyableOrMovableClass {
 
     FirmwareUtil *getFwUtilInterface();
     PmuInterface *getPmuInterface() { return pPmuInterface; }
+    std::shared_ptr<PmuEventGroup> getEngineActivityEventGroup();
     FsAccessInterface &getFsAccess();
     ProcFsAccessInterface &getProcfsAccess();
     SysFsAccessInterface &getSysfsAccess();
@@ -91,6 +94,8 @@ class LinuxSysmanImp : public OsSysman, NEO::NonCopyableOrMovableClass {
     uint32_t subDeviceCount = 0;
     FirmwareUtil *pFwUtilInterface = nullptr;
     PmuInterface *pPmuInterface = nullptr;
+    // Shared by engine handles, released together with the last of them
+    std::weak_ptr<PmuEventGroup> engineActivityEventGroup;
     std::string rootPath;
     void releaseFwUtilInterface();
     uint32_t memType = unknownMemoryType;
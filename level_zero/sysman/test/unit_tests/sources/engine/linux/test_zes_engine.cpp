@@ -6,7 +6,9 @@
  */
 
 #include "shared/source/os_interface/linux/memory_info.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 
+#include "level_zero/sysman/source/device/sysman_telemetry_sampler.h"
 #include "level_zero/sysman/source/shared/linux/kmd_interface/sysman_kmd_interface.h"
 #include "level_zero/sysman/source/shared/linux/sysman_fs_access_interface.h"
 #include "level_zero/sysman/test/unit_tests/sources/engine/linux/mock_engine.h"
@@ -188,6 +190,96 @@ TEST_F(ZesEngineFixtureI915, GivenValidEngineHandleWhenCallingZesEngineGetActivi
     }
 }
 
+TEST_F(ZesEngineFixtureI915, GivenEngineActivityPmuGroupEnabledWhenCallingGetActivityOnEachEngineThenAllEnginesAreServedFromSingleGroupRead) {
+    struct MockGroupPmuInterface : public MockEnginePmuInterfaceImp {
+        using MockEnginePmuInterfaceImp::MockEnginePmuInterfaceImp;
+        int64_t nextFd = 10;
+        std::vector<int> openGroupFds;
+        uint32_t pmuReadCalled = 0;
+
+        int64_t pmuInterfaceOpen(uint64_t config, int group, uint32_t format) override {
+            EXPECT_NE(0u, format & PERF_FORMAT_GROUP);
+            openGroupFds.push_back(group);
+            return nextFd++;
+        }
+
+        int pmuRead(int fd, uint64_t *data, ssize_t sizeOfdata) override {
+            pmuReadCalled++;
+            EXPECT_EQ(10, fd);
+            EXPECT_EQ(static_cast<ssize_t>(4 * sizeof(uint64_t)), sizeOfdata);
+            data[0] = 2u;
+            data[1] = 5000u * pmuReadCalled;
+            data[2] = 1000u * pmuReadCalled;
+            data[3] = 3000u * pmuReadCalled;
+            return 0;
+        }
+    };
+
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.SysmanEngineActivityPmuGroup.set(1);
+    auto pGroupPmuInterface = std::make_unique<MockGroupPmuInterface>(pLinuxSysmanImp);
+    pLinuxSysmanImp->pPmuInterface = pGroupPmuInterface.get();
+
+    auto pRenderEngine = std::make_unique<L0::Sysman::LinuxEngineImp>(pOsSysman, ZES_ENGINE_GROUP_RENDER_SINGLE, 0u, 0u, false);
+    auto pCopyEngine = std::make_unique<L0::Sysman::LinuxEngineImp>(pOsSysman, ZES_ENGINE_GROUP_COPY_SINGLE, 0u, 0u, false);
+    EXPECT_TRUE(pRenderEngine->isEngineModuleSupported());
+    EXPECT_TRUE(pCopyEngine->isEngineModuleSupported());
+    ASSERT_EQ(2u, pGroupPmuInterface->openGroupFds.size());
+    EXPECT_EQ(-1, pGroupPmuInterface->openGroupFds[0]);
+    EXPECT_EQ(10, pGroupPmuInterface->openGroupFds[1]);
+
+    zes_engine_stats_t renderStats = {};
+    zes_engine_stats_t copyStats = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pRenderEngine->getActivity(&renderStats));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pCopyEngine->getActivity(&copyStats));
+    EXPECT_EQ(1u, pGroupPmuInterface->pmuReadCalled);
+    EXPECT_EQ(1u, renderStats.activeTime);
+    EXPECT_EQ(3u, copyStats.activeTime);
+    EXPECT_EQ(5u, renderStats.timestamp);
+    EXPECT_EQ(renderStats.timestamp, copyStats.timestamp);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pRenderEngine->getActivity(&renderStats));
+    EXPECT_EQ(2u, pGroupPmuInterface->pmuReadCalled);
+    EXPECT_EQ(2u, renderStats.activeTime);
+    EXPECT_EQ(10u, renderStats.timestamp);
+
+    pRenderEngine.reset();
+    pCopyEngine.reset();
+    pLinuxSysmanImp->pPmuInterface = pPmuInterface.get();
+}
+
+TEST_F(ZesEngineFixtureI915, GivenTelemetrySamplerWhenCallingEngineGetActivityThenLatestSampleIsReturnedInsteadOfReadingPmu) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> mockPread(&NEO::SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        std::string value = "23";
+        memcpy(buf, value.data(), value.size());
+        return value.size();
+    });
+
+    EXPECT_EQ(nullptr, pLinuxSysmanImp->getTelemetrySampler());
+    pLinuxSysmanImp->pTelemetrySampler = std::make_unique<L0::Sysman::TelemetrySampler>(1000u);
+    auto pSampler = pLinuxSysmanImp->getTelemetrySampler();
+
+    auto pEngine = std::make_unique<L0::Sysman::EngineImp>(pOsSysman, ZES_ENGINE_GROUP_RENDER_SINGLE, 0u, 0u, false);
+    ASSERT_TRUE(pEngine->initSuccess);
+    const uint64_t sampledActiveTime = pPmuInterface->mockActiveTime;
+
+    zes_engine_stats_t stats = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pEngine->engineGetActivity(&stats));
+    EXPECT_EQ(sampledActiveTime / microSecondsToNanoSeconds, stats.activeTime);
+
+    pSampler->collectSamples();
+    EXPECT_EQ(1u, pSampler->getStatistics().samplesCollected);
+
+    pPmuInterface->mockActiveTime = sampledActiveTime * 2;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pEngine->engineGetActivity(&stats));
+    EXPECT_EQ(sampledActiveTime / microSecondsToNanoSeconds, stats.activeTime);
+
+    pEngine.reset();
+    pSampler->collectSamples();
+    EXPECT_EQ(1u, pSampler->getStatistics().samplesCollected);
+    EXPECT_EQ(2u, pSampler->getStatistics().samplingRounds);
+}
+
 TEST_F(ZesEngineFixtureI915, GivenValidEngineHandleWhenCallingZesEngineGetActivityAndperfEventOpenFailsThenVerifyEngineGetActivityReturnsFailure) {
 
     VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> mockPread(&NEO::SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
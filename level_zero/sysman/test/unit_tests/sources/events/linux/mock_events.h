@@ -177,7 +177,10 @@ struct MockEventsSysfsAccess : public L0::Sysman::SysFsAccessInterface {
     ze_result_t getRealPathResult = ZE_RESULT_SUCCESS;
     std::string realPath = "/sys/devices/pci0000:97/0000:97:02.0/0000:98:00.0/0000:99:01.0/0000:9a:00.0";
 
+    uint32_t getRealPathCalled = 0;
+
     ze_result_t getRealPath(const std::string file, std::string &val) override {
+        getRealPathCalled++;
         val = realPath;
         return getRealPathResult;
     }
@@ -301,9 +304,11 @@ class PublicLinuxEventsUtil : public L0::Sysman::LinuxEventsUtil {
   public:
     PublicLinuxEventsUtil(L0::Sysman::LinuxSysmanDriverImp *pLinuxSysmanDriverImp) : LinuxEventsUtil(pLinuxSysmanDriverImp) {}
     using LinuxEventsUtil::deviceEventsMap;
+    using LinuxEventsUtil::deviceToDevPathMap;
     using LinuxEventsUtil::listenSystemEvents;
     using LinuxEventsUtil::pipeFd;
     using LinuxEventsUtil::pUdevLib;
+    using LinuxEventsUtil::udevMonitorFd;
 };
 
 } // namespace ult
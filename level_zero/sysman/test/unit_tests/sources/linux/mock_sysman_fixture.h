@@ -45,6 +45,7 @@ class PublicLinuxSysmanImp : public L0::Sysman::LinuxSysmanImp {
     using LinuxSysmanImp::pSysfsAccess;
     using LinuxSysmanImp::pSysmanKmdInterface;
     using LinuxSysmanImp::pSysmanProductHelper;
+    using LinuxSysmanImp::pTelemetrySampler;
     using LinuxSysmanImp::rootPath;
 };
 
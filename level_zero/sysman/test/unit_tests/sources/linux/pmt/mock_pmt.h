@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -152,6 +152,7 @@ class PublicPlatformMonitoringTech : public L0::Sysman::PlatformMonitoringTech {
     using PlatformMonitoringTech::preadFunction;
     using PlatformMonitoringTech::rootDeviceTelemNodeIndex;
     using PlatformMonitoringTech::telemetryDeviceEntry;
+    using PlatformMonitoringTech::telemetryFd;
 };
 
 } // namespace ult
@@ -5,6 +5,8 @@
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
 #include "level_zero/sysman/source/shared/linux/product_helper/sysman_product_helper_hw.h"
 #include "level_zero/sysman/test/unit_tests/sources/linux/mock_sysman_fixture.h"
 #include "level_zero/sysman/test/unit_tests/sources/linux/mocks/mock_sysman_product_helper.h"
@@ -189,6 +191,88 @@ TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint6
     EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("DUMMY_KEY", val));
 }
 
+TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingReadValueMultipleTimesThenTelemetryFileIsOpenedOnceAndClosedOnDestruction) {
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, openMockReturnSuccess);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> preadBackup(&NEO::SysCalls::sysCallsPread, preadMockPmt);
+    VariableBackup<uint32_t> openCalledBackup(&NEO::SysCalls::openFuncCalled, 0u);
+
+    uint32_t val = 0;
+    pPmt->keyOffsetMap = dummyKeyOffsetMap;
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("DUMMY_KEY", val));
+    }
+    EXPECT_EQ(1u, NEO::SysCalls::openFuncCalled);
+    EXPECT_EQ(0u, NEO::SysCalls::closeFuncCalled);
+
+    pPmt.reset();
+    EXPECT_EQ(1u, NEO::SysCalls::closeFuncCalled);
+}
+
+TEST_F(ZesPmtFixtureMultiDevice, GivenPreadFailsWhenCallingReadValueThenTelemetryFileIsClosedAndReopenedOnNextRead) {
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, openMockReturnSuccess);
+    VariableBackup<uint32_t> openCalledBackup(&NEO::SysCalls::openFuncCalled, 0u);
+
+    uint32_t val = 0;
+    pPmt->keyOffsetMap = dummyKeyOffsetMap;
+    pPmt->preadFunction = preadMockPmtFailure;
+    EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("DUMMY_KEY", val));
+    EXPECT_EQ(1u, NEO::SysCalls::closeFuncCalled);
+    EXPECT_EQ(-1, pPmt->telemetryFd);
+
+    pPmt->preadFunction = preadMockPmt;
+    NEO::SysCalls::closeFuncCalled = 0u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("DUMMY_KEY", val));
+    EXPECT_EQ(2u, NEO::SysCalls::openFuncCalled);
+    EXPECT_EQ(3u, val);
+}
+
+static uint32_t preadSnapshotCalled = 0u;
+ssize_t preadMockPmtSnapshot(int fd, void *buf, size_t count, off_t offset) {
+    preadSnapshotCalled++;
+    auto bytes = reinterpret_cast<uint8_t *>(buf);
+    for (size_t i = 0; i < count; i++) {
+        bytes[i] = static_cast<uint8_t>(offset + i);
+    }
+    return count;
+}
+
+TEST_F(ZesPmtFixtureMultiDevice, GivenSnapshotValidityWhenReadingMultipleKeysThenAllKeysAreServedFromSingleRead) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.SysmanPmtSnapshotValidityMs.set(100000);
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, openMockReturnSuccess);
+    VariableBackup<uint32_t> preadCalledBackup(&preadSnapshotCalled, 0u);
+    pPmt->preadFunction = preadMockPmtSnapshot;
+    pPmt->keyOffsetMap = {{"KEY_A", 0x10}, {"KEY_B", 0x18}, {"KEY_C", 0x20}};
+
+    uint32_t valueA = 0;
+    uint64_t valueB = 0;
+    uint32_t valueC = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("KEY_A", valueA));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("KEY_B", valueB));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("KEY_C", valueC));
+    EXPECT_EQ(1u, preadSnapshotCalled);
+
+    EXPECT_EQ(0x13121110u, valueA);
+    EXPECT_EQ(0x1f1e1d1c1b1a1918u, valueB);
+    EXPECT_EQ(0x23222120u, valueC);
+}
+
+TEST_F(ZesPmtFixtureMultiDevice, GivenSnapshotValidityAndPreadFailsWhenReadingKeyThenErrorIsReturned) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.SysmanPmtSnapshotValidityMs.set(100000);
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, openMockReturnSuccess);
+    pPmt->preadFunction = preadMockPmtFailure;
+    pPmt->keyOffsetMap = dummyKeyOffsetMap;
+
+    uint64_t val = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("DUMMY_KEY", val));
+    EXPECT_EQ(-1, pPmt->telemetryFd);
+}
+
 TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenDoingPMTInitThenPMTmapOfSubDeviceIdToPmtObjectWouldContainValidEntries) {
     std::unique_ptr<SysmanProductHelper> pSysmanProductHelper = std::make_unique<MockSysmanProductHelper>();
     std::swap(pLinuxSysmanImp->pSysmanProductHelper, pSysmanProductHelper);
@@ -1,10 +1,11 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "level_zero/sysman/source/shared/linux/pmu/sysman_pmu_event_group.h"
 #include "level_zero/sysman/test/unit_tests/sources/linux/mock_sysman_fixture.h"
 #include "level_zero/sysman/test/unit_tests/sources/linux/pmu/mock_pmu.h"
 
@@ -155,6 +156,144 @@ TEST_F(SysmanPmuFixture, GivenValidPmuHandleWhenAndDomainErrorOccursThenDomainEr
     EXPECT_EQ(EDOM, pmuInterface->getErrorNo());
 }
 
+class MockPmuInterfaceForEventGroup : public L0::Sysman::PmuInterface {
+  public:
+    int64_t nextFd = 20;
+    int64_t openResult = 0;
+    uint64_t readEventCount = 0;
+    int readResult = 0;
+    uint32_t pmuReadCalled = 0;
+    std::vector<int> openGroupFds;
+
+    int64_t pmuInterfaceOpen(uint64_t config, int group, uint32_t format) override {
+        if (openResult < 0) {
+            return openResult;
+        }
+        openGroupFds.push_back(group);
+        return nextFd++;
+    }
+
+    int pmuRead(int fd, uint64_t *data, ssize_t sizeOfdata) override {
+        pmuReadCalled++;
+        if (readResult < 0) {
+            return readResult;
+        }
+        auto count = static_cast<size_t>(sizeOfdata) / sizeof(uint64_t);
+        data[0] = readEventCount;
+        data[1] = mockTimeStamp * pmuReadCalled;
+        for (size_t i = 2; i < count; i++) {
+            data[i] = mockEventVal * i * pmuReadCalled;
+        }
+        return 0;
+    }
+};
+
+TEST(SysmanPmuEventGroupTest, GivenEventGroupWhenAddingEventsThenFirstEventIsGroupLeaderForOthers) {
+    MockPmuInterfaceForEventGroup pmuInterface;
+    L0::Sysman::PmuEventGroup eventGroup(&pmuInterface);
+
+    EXPECT_EQ(0, eventGroup.addEvent(1u));
+    EXPECT_EQ(1, eventGroup.addEvent(2u));
+    EXPECT_EQ(2, eventGroup.addEvent(3u));
+    EXPECT_EQ(3u, eventGroup.getEventCount());
+    EXPECT_EQ(20, eventGroup.getEventFd(0));
+    EXPECT_EQ(22, eventGroup.getEventFd(2));
+
+    ASSERT_EQ(3u, pmuInterface.openGroupFds.size());
+    EXPECT_EQ(-1, pmuInterface.openGroupFds[0]);
+    EXPECT_EQ(20, pmuInterface.openGroupFds[1]);
+    EXPECT_EQ(20, pmuInterface.openGroupFds[2]);
+
+    pmuInterface.openResult = -ENOENT;
+    EXPECT_EQ(-1, eventGroup.addEvent(4u));
+    EXPECT_EQ(3u, eventGroup.getEventCount());
+}
+
+TEST(SysmanPmuEventGroupTest, GivenEventGroupWhenReadingEachEventOnceThenGroupIsReadOnlyOnceAndReadAgainWhenEventIsReadSecondTime) {
+    MockPmuInterfaceForEventGroup pmuInterface;
+    pmuInterface.readEventCount = 2u;
+    L0::Sysman::PmuEventGroup eventGroup(&pmuInterface);
+    ASSERT_EQ(0, eventGroup.addEvent(1u));
+    ASSERT_EQ(1, eventGroup.addEvent(2u));
+
+    uint64_t value = 0;
+    uint64_t timeEnabled = 0;
+    EXPECT_EQ(0, eventGroup.readEvent(1u, value, timeEnabled));
+    EXPECT_EQ(mockEventVal * 3, value);
+    EXPECT_EQ(mockTimeStamp, timeEnabled);
+    EXPECT_EQ(0, eventGroup.readEvent(0u, value, timeEnabled));
+    EXPECT_EQ(mockEventVal * 2, value);
+    EXPECT_EQ(mockTimeStamp, timeEnabled);
+    EXPECT_EQ(1u, pmuInterface.pmuReadCalled);
+
+    EXPECT_EQ(0, eventGroup.readEvent(0u, value, timeEnabled));
+    EXPECT_EQ(mockEventVal * 2 * 2, value);
+    EXPECT_EQ(mockTimeStamp * 2, timeEnabled);
+    EXPECT_EQ(2u, pmuInterface.pmuReadCalled);
+}
+
+struct MockPmuEventGroup : public L0::Sysman::PmuEventGroup {
+    using L0::Sysman::PmuEventGroup::lastReadTime;
+    using L0::Sysman::PmuEventGroup::maxDataAge;
+    using L0::Sysman::PmuEventGroup::PmuEventGroup;
+};
+
+TEST(SysmanPmuEventGroupTest, GivenEventGroupWhenEventIsReadLongAfterOtherEventThenGroupIsReadAgain) {
+    MockPmuInterfaceForEventGroup pmuInterface;
+    pmuInterface.readEventCount = 2u;
+    MockPmuEventGroup eventGroup(&pmuInterface);
+    ASSERT_EQ(0, eventGroup.addEvent(1u));
+    ASSERT_EQ(1, eventGroup.addEvent(2u));
+
+    uint64_t value = 0;
+    uint64_t timeEnabled = 0;
+    EXPECT_EQ(0, eventGroup.readEvent(0u, value, timeEnabled));
+    EXPECT_EQ(mockEventVal * 2, value);
+    EXPECT_EQ(1u, pmuInterface.pmuReadCalled);
+
+    eventGroup.lastReadTime -= std::chrono::seconds(60) + MockPmuEventGroup::maxDataAge;
+    EXPECT_EQ(0, eventGroup.readEvent(1u, value, timeEnabled));
+    EXPECT_EQ(mockEventVal * 3 * 2, value);
+    EXPECT_EQ(mockTimeStamp * 2, timeEnabled);
+    EXPECT_EQ(2u, pmuInterface.pmuReadCalled);
+}
+
+TEST(SysmanPmuEventGroupTest, GivenEventGroupWhenReadFailsOrReturnsUnexpectedEventCountOrIndexIsInvalidThenErrorIsReturned) {
+    MockPmuInterfaceForEventGroup pmuInterface;
+    pmuInterface.readEventCount = 2u;
+    L0::Sysman::PmuEventGroup eventGroup(&pmuInterface);
+    ASSERT_EQ(0, eventGroup.addEvent(1u));
+
+    uint64_t value = 0;
+    uint64_t timeEnabled = 0;
+    EXPECT_EQ(-1, eventGroup.readEvent(1u, value, timeEnabled));
+    EXPECT_EQ(0u, pmuInterface.pmuReadCalled);
+
+    EXPECT_EQ(-1, eventGroup.readEvent(0u, value, timeEnabled));
+    EXPECT_EQ(1u, pmuInterface.pmuReadCalled);
+
+    pmuInterface.readEventCount = 1u;
+    pmuInterface.readResult = -1;
+    EXPECT_EQ(-1, eventGroup.readEvent(0u, value, timeEnabled));
+    EXPECT_EQ(2u, pmuInterface.pmuReadCalled);
+
+    pmuInterface.readResult = 0;
+    EXPECT_EQ(0, eventGroup.readEvent(0u, value, timeEnabled));
+    EXPECT_EQ(mockEventVal * 2 * 3, value);
+}
+
+TEST(SysmanPmuEventGroupTest, GivenEventGroupWithEventsWhenDestroyingGroupThenAllEventFdsAreClosed) {
+    MockPmuInterfaceForEventGroup pmuInterface;
+    VariableBackup<uint32_t> closeCounter(&NEO::SysCalls::closeFuncCalled, 0u);
+    {
+        L0::Sysman::PmuEventGroup eventGroup(&pmuInterface);
+        ASSERT_EQ(0, eventGroup.addEvent(1u));
+        ASSERT_EQ(1, eventGroup.addEvent(2u));
+    }
+    EXPECT_EQ(2u, NEO::SysCalls::closeFuncCalled);
+    EXPECT_EQ(20, NEO::SysCalls::closeFuncArgPassed);
+}
+
 } // namespace ult
 } // namespace Sysman
 } // namespace L0
@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_driver_info.h"
 #include "shared/test/common/mocks/mock_driver_model.h"
 #include "shared/test/common/test_macros/test.h"
@@ -244,11 +245,11 @@ TEST(FdCacheTest, GivenValidFdCacheWhenCallingGetFdOnSameFileThenVerifyCacheIsUp
     // Get Fd after the cache is full.
     EXPECT_LE(0, pFdCache->getFd("dummy.txt"));
 
-    // Verify Cache have the elements that are accessed more number of times
+    // Verify Cache have the elements that are accessed more recently
     EXPECT_NE(pFdCache->fdMap.end(), pFdCache->fdMap.find("mockfile0.txt"));
 
-    // Verify cache doesn't have an element that is accessed less number of times.
-    EXPECT_EQ(pFdCache->fdMap.end(), pFdCache->fdMap.find("mockfile9.txt"));
+    // Verify cache doesn't have the least recently used element.
+    EXPECT_EQ(pFdCache->fdMap.end(), pFdCache->fdMap.find("mockfile" + std::to_string(L0::Sysman::FdCacheInterface::maxSize - 1) + ".txt"));
 }
 
 TEST(FdCacheTest, GivenValidFdCacheWhenClearingCacheThenVerifyProperFdsAreClosedAndCacheIsUpdatedProperly) {
@@ -287,15 +288,53 @@ TEST(FdCacheTest, GivenValidFdCacheWhenClearingCacheThenVerifyProperFdsAreClosed
     // Get Fd after the cache is full.
     EXPECT_LE(0, pFdCache->getFd("dummy.txt"));
 
-    // Verify Cache have the elements that are accessed more number of times
+    // Verify Cache have the elements that are accessed more recently
     EXPECT_NE(pFdCache->fdMap.end(), pFdCache->fdMap.find("mockfile0.txt"));
 
-    // Verify cache doesn't have an element that is accessed less number of times.
-    EXPECT_EQ(pFdCache->fdMap.end(), pFdCache->fdMap.find("mockfile9.txt"));
+    // Verify cache doesn't have the least recently used element.
+    EXPECT_EQ(pFdCache->fdMap.end(), pFdCache->fdMap.find("mockfile" + std::to_string(L0::Sysman::FdCacheInterface::maxSize - 1) + ".txt"));
 
     delete pFdCache;
 }
 
+TEST(FdCacheTest, GivenFdCacheSizeDebugFlagWhenCallingGetFdOnMoreFilesThanCapacityThenLeastRecentlyUsedFdIsClosedAndCachedFdsAreNotReopened) {
+    class MockFdCache : public FdCacheInterface {
+      public:
+        using FdCacheInterface::fdList;
+        using FdCacheInterface::fdMap;
+    };
+
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.SysmanFdCacheSize.set(2);
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return static_cast<int>(std::string(pathname).size());
+    });
+    VariableBackup<uint32_t> openCounter(&NEO::SysCalls::openFuncCalled, 0u);
+    VariableBackup<uint32_t> closeCounter(&NEO::SysCalls::closeFuncCalled, 0u);
+
+    auto pFdCache = std::make_unique<MockFdCache>();
+    EXPECT_EQ(2u, pFdCache->getCapacity());
+
+    EXPECT_EQ(1, pFdCache->getFd("a"));
+    EXPECT_EQ(2, pFdCache->getFd("bb"));
+    EXPECT_EQ(1, pFdCache->getFd("a"));
+    EXPECT_EQ(2u, NEO::SysCalls::openFuncCalled);
+    EXPECT_EQ(0u, NEO::SysCalls::closeFuncCalled);
+
+    EXPECT_EQ(3, pFdCache->getFd("ccc"));
+    EXPECT_EQ(3u, NEO::SysCalls::openFuncCalled);
+    EXPECT_EQ(1u, NEO::SysCalls::closeFuncCalled);
+    EXPECT_EQ(2u, pFdCache->fdList.size());
+    EXPECT_EQ(2u, pFdCache->fdMap.size());
+    EXPECT_NE(pFdCache->fdMap.end(), pFdCache->fdMap.find("a"));
+    EXPECT_EQ(pFdCache->fdMap.end(), pFdCache->fdMap.find("bb"));
+    EXPECT_EQ("ccc", pFdCache->fdList.front().first);
+
+    pFdCache.reset();
+    EXPECT_EQ(3u, NEO::SysCalls::closeFuncCalled);
+}
+
 TEST_F(SysmanDeviceFixture, GivenSysfsAccessClassAndOpenSysCallFailsWhenCallingReadThenFailureIsReturned) {
 
     VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen(&NEO::SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
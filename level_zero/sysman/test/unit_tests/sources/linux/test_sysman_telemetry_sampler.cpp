@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "level_zero/sysman/source/device/sysman_telemetry_sampler.h"
+
+#include <chrono>
+#include <thread>
+
+namespace L0 {
+namespace Sysman {
+namespace ult {
+
+TEST(SysmanTelemetryHistoryTest, GivenEmptyHistoryWhenGettingLatestSampleThenFalseIsReturned) {
+    TelemetryHistory history;
+    TelemetrySample sample;
+    EXPECT_FALSE(history.getLatest(sample));
+    EXPECT_EQ(0u, history.getSampleCount());
+
+    std::vector<TelemetrySample> samples;
+    history.getSamples(0u, samples);
+    EXPECT_TRUE(samples.empty());
+}
+
+TEST(SysmanTelemetryHistoryTest, GivenMoreSamplesThanCapacityWhenGettingSamplesThenOnlyNewestSamplesAreReturnedNewestFirst) {
+    TelemetryHistory history;
+    const uint64_t sampleCount = TelemetryHistory::capacity + 10;
+    for (uint64_t i = 1; i <= sampleCount; i++) {
+        TelemetrySample sample;
+        sample.sampleTime = i * 10;
+        sample.values[0] = i;
+        sample.values[1] = i * 100;
+        history.push(sample);
+    }
+
+    TelemetrySample latest;
+    EXPECT_TRUE(history.getLatest(latest));
+    EXPECT_EQ(sampleCount * 10, latest.sampleTime);
+    EXPECT_EQ(sampleCount, latest.values[0]);
+    EXPECT_EQ(sampleCount * 100, latest.values[1]);
+    EXPECT_EQ(sampleCount, history.getSampleCount());
+
+    std::vector<TelemetrySample> samples;
+    history.getSamples(0u, samples);
+    ASSERT_EQ(TelemetryHistory::capacity, samples.size());
+    EXPECT_EQ(sampleCount, samples.front().values[0]);
+    EXPECT_EQ(sampleCount - TelemetryHistory::capacity + 1, samples.back().values[0]);
+
+    history.getSamples((sampleCount - 2) * 10, samples);
+    ASSERT_EQ(3u, samples.size());
+    EXPECT_EQ(sampleCount - 2, samples.back().values[0]);
+}
+
+TEST(SysmanTelemetryHistoryTest, GivenSamplesInWindowWhenGettingWindowStatisticsThenAverageAndMaxAreReturned) {
+    TelemetryHistory history;
+    const uint64_t values[] = {40, 10, 30, 20};
+    for (uint64_t i = 0; i < 4; i++) {
+        TelemetrySample sample;
+        sample.sampleTime = 100 + i;
+        sample.values[1] = values[i];
+        history.push(sample);
+    }
+
+    uint64_t average = 0;
+    uint64_t max = 0;
+    EXPECT_TRUE(history.getWindowStatistics(100u, 1u, average, max));
+    EXPECT_EQ(25u, average);
+    EXPECT_EQ(40u, max);
+
+    EXPECT_TRUE(history.getWindowStatistics(102u, 1u, average, max));
+    EXPECT_EQ(25u, average);
+    EXPECT_EQ(30u, max);
+
+    EXPECT_FALSE(history.getWindowStatistics(200u, 1u, average, max));
+}
+
+TEST(SysmanTelemetrySamplerTest, GivenSourcesWhenCollectingSamplesThenHistoriesAreUpdatedAndStatisticsAreCounted) {
+    TelemetrySampler sampler(1000u);
+    uint64_t counter = 0;
+    auto history = sampler.addSource([&counter](TelemetrySample &sample) {
+        counter++;
+        sample.values[0] = counter;
+        sample.values[1] = counter * 2;
+        return ZE_RESULT_SUCCESS;
+    });
+    auto failingHistory = sampler.addSource([](TelemetrySample &sample) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    });
+
+    sampler.collectSamples();
+    sampler.collectSamples();
+
+    TelemetrySample sample;
+    EXPECT_TRUE(history->getLatest(sample));
+    EXPECT_EQ(2u, sample.values[0]);
+    EXPECT_EQ(4u, sample.values[1]);
+    EXPECT_NE(0u, sample.sampleTime);
+    EXPECT_FALSE(failingHistory->getLatest(sample));
+
+    auto statistics = sampler.getStatistics();
+    EXPECT_EQ(2u, statistics.samplingRounds);
+    EXPECT_EQ(2u, statistics.samplesCollected);
+    EXPECT_EQ(2u, statistics.sampleFailures);
+
+    sampler.removeSource(history.get());
+    sampler.collectSamples();
+    EXPECT_EQ(2u, counter);
+    EXPECT_EQ(2u, history->getSampleCount());
+    EXPECT_EQ(3u, sampler.getStatistics().sampleFailures);
+}
+
+TEST(SysmanTelemetrySamplerTest, GivenStartedSamplerWhenWaitingThenSamplesAreCollectedByThreadUntilStopped) {
+    TelemetrySampler sampler(1u);
+    std::atomic<uint32_t> sampleCount{0};
+    auto history = sampler.addSource([&sampleCount](TelemetrySample &sample) {
+        sample.values[0] = ++sampleCount;
+        return ZE_RESULT_SUCCESS;
+    });
+
+    sampler.start();
+    sampler.start();
+    auto waitStart = std::chrono::steady_clock::now();
+    while (history->getSampleCount() < 2u && std::chrono::steady_clock::now() - waitStart < std::chrono::seconds(10)) {
+        std::this_thread::yield();
+    }
+    sampler.stop();
+    sampler.stop();
+
+    EXPECT_LE(2u, history->getSampleCount());
+    const auto collected = sampleCount.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_EQ(collected, sampleCount.load());
+}
+
+TEST(SysmanTelemetrySamplerTest, GivenSamplingIntervalDebugFlagWhenCreatingSamplerThenSamplerIsCreatedOnlyWhenIntervalIsPositive) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(nullptr, TelemetrySampler::create());
+
+    NEO::debugManager.flags.SysmanTelemetrySamplingIntervalMs.set(0);
+    EXPECT_EQ(nullptr, TelemetrySampler::create());
+
+    NEO::debugManager.flags.SysmanTelemetrySamplingIntervalMs.set(50);
+    auto sampler = TelemetrySampler::create();
+    ASSERT_NE(nullptr, sampler);
+    EXPECT_EQ(50u, sampler->getSamplingIntervalMs());
+}
+
+} // namespace ult
+} // namespace Sysman
+} // namespace L0
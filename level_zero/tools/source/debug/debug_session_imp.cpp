@@ -399,6 +399,7 @@ DebugSessionImp::Error DebugSessionImp::resumeThreadsWithinDevice(uint32_t devic
     [[maybe_unused]] auto sipCommandResult = writeResumeCommand(resumeThreadIds);
     DEBUG_BREAK_IF(sipCommandResult != true);
 
+    invalidateStateSaveAreaSnapshots();
     auto result = resumeImp(resumeThreadIds, deviceIndex);
 
     // For resume(ALL) and multiple threads to resume - read whole state save area
@@ -777,7 +778,7 @@ void DebugSessionImp::addThreadToNewlyStoppedFromRaisedAttention(EuThread::Threa
                 return;
             }
 
-            allThreads[threadId]->stopThread(memoryHandle);
+            markThreadStopped(threadId, memoryHandle, wasStopped);
         }
     }
 
@@ -926,6 +927,7 @@ void DebugSessionImp::resumeAccidentallyStoppedThreads(const std::vector<EuThrea
         if (threadIdsPerDevice[i].size() > 0) {
             [[maybe_unused]] auto writeSipCommandResult = writeResumeCommand(threadIdsPerDevice[i]);
             DEBUG_BREAK_IF(writeSipCommandResult != true);
+            invalidateStateSaveAreaSnapshots();
             resumeImp(threadIdsPerDevice[i], i);
         }
 
@@ -1491,6 +1493,9 @@ ze_result_t DebugSessionImp::cmdRegisterAccessHelper(const EuThread::ThreadId &t
 
     PRINT_DEBUGGER_INFO_LOG("Access CMD %d for thread %s\n", command.command, EuThread::toString(threadId).c_str());
 
+    // SIP executes commands on state save area, so cached copies become stale
+    invalidateStateSaveAreaSnapshots();
+
     ze_result_t result = registersAccessHelper(allThreads[threadId].get(), regdesc, 0, 1, &command, write);
     if (result != ZE_RESULT_SUCCESS) {
         PRINT_DEBUGGER_ERROR_LOG("Failed to access CMD for thread %s\n", EuThread::toString(threadId).c_str());
@@ -1533,6 +1538,10 @@ ze_result_t DebugSessionImp::readRegistersImp(EuThread::ThreadId threadId, uint3
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
+    if (readRegistersFromStateSaveAreaSnapshot(allThreads[threadId].get(), regdesc, start, count, pRegisterValues)) {
+        return ZE_RESULT_SUCCESS;
+    }
+
     return registersAccessHelper(allThreads[threadId].get(), regdesc, start, count, pRegisterValues, false);
 }
 
@@ -1564,7 +1573,94 @@ ze_result_t DebugSessionImp::writeRegistersImp(EuThread::ThreadId threadId, uint
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
-    return registersAccessHelper(allThreads[threadId].get(), regdesc, start, count, pRegisterValues, true);
+    auto result = registersAccessHelper(allThreads[threadId].get(), regdesc, start, count, pRegisterValues, true);
+    if (result == ZE_RESULT_SUCCESS) {
+        updateStateSaveAreaSnapshot(allThreads[threadId].get(), regdesc, start, count, pRegisterValues);
+    }
+    return result;
+}
+
+void DebugSessionImp::setStateSaveAreaSnapshot(uint64_t memoryHandle, const char *stateSaveArea, size_t size) {
+    if (!stateSaveAreaSnapshotEnabled) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(stateSaveAreaSnapshotMutex);
+    stateSaveAreaSnapshots[memoryHandle].assign(stateSaveArea, stateSaveArea + size);
+}
+
+void DebugSessionImp::invalidateStateSaveAreaSnapshots() {
+    std::lock_guard<std::mutex> lock(stateSaveAreaSnapshotMutex);
+    stateSaveAreaSnapshots.clear();
+}
+
+void DebugSessionImp::invalidateStateSaveAreaSnapshot(uint64_t memoryHandle) {
+    std::lock_guard<std::mutex> lock(stateSaveAreaSnapshotMutex);
+    stateSaveAreaSnapshots.erase(memoryHandle);
+}
+
+void DebugSessionImp::markThreadStopped(EuThread::ThreadId threadId, uint64_t memoryHandle, bool wasStopped) {
+    allThreads[threadId]->stopThread(memoryHandle);
+    // snapshot may hold slot of this thread read while it was still running
+    if (!wasStopped) {
+        invalidateStateSaveAreaSnapshot(memoryHandle);
+    }
+}
+
+const std::vector<char> *DebugSessionImp::getStateSaveAreaSnapshot(uint64_t memoryHandle) {
+    auto snapshot = stateSaveAreaSnapshots.find(memoryHandle);
+    if (snapshot != stateSaveAreaSnapshots.end()) {
+        return &snapshot->second;
+    }
+
+    auto gpuVa = getContextStateSaveAreaGpuVa(memoryHandle);
+    auto stateSaveAreaSize = getContextStateSaveAreaSize(memoryHandle);
+    if (gpuVa == 0 || stateSaveAreaSize == 0) {
+        return nullptr;
+    }
+
+    std::vector<char> stateSaveArea(stateSaveAreaSize);
+    if (readGpuMemory(memoryHandle, stateSaveArea.data(), stateSaveAreaSize, gpuVa) != ZE_RESULT_SUCCESS) {
+        PRINT_DEBUGGER_ERROR_LOG("Failed to read state save area snapshot\n", "");
+        return nullptr;
+    }
+    return &(stateSaveAreaSnapshots[memoryHandle] = std::move(stateSaveArea));
+}
+
+bool DebugSessionImp::readRegistersFromStateSaveAreaSnapshot(const EuThread *thread, const SIP::regset_desc *regdesc, uint32_t start, uint32_t count, void *pRegisterValues) {
+    if (!stateSaveAreaSnapshotEnabled || start >= regdesc->num || start + count > regdesc->num) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(stateSaveAreaSnapshotMutex);
+    auto snapshot = getStateSaveAreaSnapshot(thread->getMemoryHandle());
+    if (snapshot == nullptr) {
+        return false;
+    }
+
+    auto startRegOffset = calculateThreadSlotOffset(thread->getThreadId()) + calculateRegisterOffsetInThreadSlot(regdesc, start);
+    size_t size = count * regdesc->bytes;
+    if (startRegOffset + size > snapshot->size()) {
+        return false;
+    }
+
+    memcpy_s(pRegisterValues, size, snapshot->data() + startRegOffset, size);
+    return true;
+}
+
+void DebugSessionImp::updateStateSaveAreaSnapshot(const EuThread *thread, const SIP::regset_desc *regdesc, uint32_t start, uint32_t count, const void *pRegisterValues) {
+    std::lock_guard<std::mutex> lock(stateSaveAreaSnapshotMutex);
+    auto snapshot = stateSaveAreaSnapshots.find(thread->getMemoryHandle());
+    if (snapshot == stateSaveAreaSnapshots.end()) {
+        return;
+    }
+
+    auto startRegOffset = calculateThreadSlotOffset(thread->getThreadId()) + calculateRegisterOffsetInThreadSlot(regdesc, start);
+    size_t size = count * regdesc->bytes;
+    if (startRegOffset + size > snapshot->second.size()) {
+        stateSaveAreaSnapshots.erase(snapshot);
+        return;
+    }
+    memcpy_s(snapshot->second.data() + startRegOffset, size, pRegisterValues, size);
 }
 
 bool DebugSessionImp::isValidGpuAddress(const zet_debug_memory_space_desc_t *desc) const {
@@ -19,6 +19,7 @@
 #include <condition_variable>
 #include <mutex>
 #include <queue>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace SIP {
@@ -40,6 +41,7 @@ struct DebugSessionImp : DebugSession {
 
     DebugSessionImp(const zet_debug_config_t &config, Device *device) : DebugSession(config, device) {
         tileAttachEnabled = NEO::debugManager.flags.ExperimentalEnableTileAttach.get();
+        stateSaveAreaSnapshotEnabled = NEO::debugManager.flags.EnableDebuggerStateSaveAreaSnapshot.get();
     }
 
     ze_result_t interrupt(ze_device_thread_t thread) override;
@@ -59,6 +61,8 @@ struct DebugSessionImp : DebugSession {
         }
     }
     void getNotStoppedThreads(const std::vector<EuThread::ThreadId> &threadsWithAtt, std::vector<EuThread::ThreadId> &notStoppedThreads);
+    void setStateSaveAreaSnapshot(uint64_t memoryHandle, const char *stateSaveArea, size_t size);
+    void invalidateStateSaveAreaSnapshots();
 
     virtual void attachTile() = 0;
     virtual void detachTile() = 0;
@@ -125,6 +129,11 @@ struct DebugSessionImp : DebugSession {
 
     ze_result_t registersAccessHelper(const EuThread *thread, const SIP::regset_desc *regdesc,
                                       uint32_t start, uint32_t count, void *pRegisterValues, bool write);
+    void invalidateStateSaveAreaSnapshot(uint64_t memoryHandle);
+    void markThreadStopped(EuThread::ThreadId threadId, uint64_t memoryHandle, bool wasStopped);
+    const std::vector<char> *getStateSaveAreaSnapshot(uint64_t memoryHandle);
+    bool readRegistersFromStateSaveAreaSnapshot(const EuThread *thread, const SIP::regset_desc *regdesc, uint32_t start, uint32_t count, void *pRegisterValues);
+    void updateStateSaveAreaSnapshot(const EuThread *thread, const SIP::regset_desc *regdesc, uint32_t start, uint32_t count, const void *pRegisterValues);
 
     void slmSipVersionCheck();
     MOCKABLE_VIRTUAL ze_result_t cmdRegisterAccessHelper(const EuThread::ThreadId &threadId, SIP::sip_command &command, bool write);
@@ -180,6 +189,12 @@ struct DebugSessionImp : DebugSession {
     bool sipSupportsSlm = false;
     std::vector<char> stateSaveAreaMemory;
 
+    // Whole state save areas of contexts with stopped threads, read in one transfer and kept
+    // until threads are resumed or SIP command is issued
+    bool stateSaveAreaSnapshotEnabled = false;
+    std::mutex stateSaveAreaSnapshotMutex;
+    std::unordered_map<uint64_t, std::vector<char>> stateSaveAreaSnapshots;
+
     std::vector<std::pair<DebugSessionImp *, bool>> tileSessions; // DebugSession, attached
     bool tileAttachEnabled = false;
     bool tileSessionsEnabled = false;
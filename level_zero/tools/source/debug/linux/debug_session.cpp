@@ -257,11 +257,26 @@ void DebugSessionLinux::checkStoppedThreadsAndGenerateEvents(const std::vector<E
     auto cr0 = std::make_unique<uint32_t[]>(regSize / sizeof(uint32_t));
     auto regDesc = typeToRegsetDesc(ZET_DEBUG_REGSET_TYPE_CR_INTEL_GPU);
 
+    // Read SR idents of all threads with single state save area read instead of one read per thread
+    std::vector<char> stateSaveArea;
+    if (stateSaveAreaSnapshotEnabled && threadsToCheck.size() > 1) {
+        auto gpuVa = getContextStateSaveAreaGpuVa(memoryHandle);
+        auto stateSaveAreaSize = getContextStateSaveAreaSize(memoryHandle);
+        if (gpuVa != 0 && stateSaveAreaSize != 0) {
+            stateSaveArea.resize(stateSaveAreaSize);
+            if (readGpuMemory(memoryHandle, stateSaveArea.data(), stateSaveAreaSize, gpuVa) != ZE_RESULT_SUCCESS) {
+                stateSaveArea.clear();
+            }
+        }
+    }
+
     for (auto &threadId : threadsToCheck) {
         SIP::sr_ident srMagic = {{0}};
         srMagic.count = 0;
 
-        if (readSystemRoutineIdent(allThreads[threadId].get(), memoryHandle, srMagic)) {
+        bool srMagicRead = stateSaveArea.empty() ? readSystemRoutineIdent(allThreads[threadId].get(), memoryHandle, srMagic)
+                                                 : readSystemRoutineIdentFromMemory(allThreads[threadId].get(), stateSaveArea.data(), srMagic);
+        if (srMagicRead) {
             bool wasStopped = allThreads[threadId]->isStopped();
             bool checkIfStopped = true;
 
@@ -271,7 +286,7 @@ void DebugSessionLinux::checkStoppedThreadsAndGenerateEvents(const std::vector<E
             }
 
             if (checkIfStopped && allThreads[threadId]->verifyStopped(srMagic.count)) {
-                allThreads[threadId]->stopThread(memoryHandle);
+                markThreadStopped(threadId, memoryHandle, wasStopped);
                 if (!wasStopped) {
                     stoppedThreadsToReport.push_back(threadId);
                 }
@@ -738,6 +753,9 @@ void DebugSessionLinux::updateStoppedThreadsAndCheckTriggerEvents(AttentionEvent
                     addThreadToNewlyStoppedFromRaisedAttention(threadId, vmHandle, stateSaveAreaMemory.data());
                 }
             }
+
+            auto session = tileSessionsEnabled ? tileSessions[tileIndex].first : this;
+            session->setStateSaveAreaSnapshot(vmHandle, stateSaveAreaMemory.data(), stateSaveAreaSize);
         }
     }
     if (tileSessionsEnabled) {
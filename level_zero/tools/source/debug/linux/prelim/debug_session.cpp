@@ -1040,7 +1040,6 @@ void DebugSessionLinuxi915::handlePageFaultEvent(prelim_drm_i915_debug_event_pag
     allocateStateSaveAreaMemory(stateSaveAreaSize);
     auto stateSaveReadResult = readGpuMemory(vmHandle, stateSaveAreaMemory.data(), stateSaveAreaSize, gpuVa);
     if (stateSaveReadResult == ZE_RESULT_SUCCESS) {
-
         std::unique_lock<std::mutex> lock;
         if (tileSessionsEnabled) {
             lock = std::unique_lock<std::mutex>(static_cast<TileDebugSessionLinuxi915 *>(tileSessions[tileIndex].first)->threadStateMutex);
@@ -1062,6 +1061,9 @@ void DebugSessionLinuxi915::handlePageFaultEvent(prelim_drm_i915_debug_event_pag
                 addThreadToNewlyStoppedFromRaisedAttention(threadId, vmHandle, stateSaveAreaMemory.data());
             }
         }
+
+        auto session = tileSessionsEnabled ? tileSessions[tileIndex].first : this;
+        session->setStateSaveAreaSnapshot(vmHandle, stateSaveAreaMemory.data(), stateSaveAreaSize);
     }
 
     if (tileSessionsEnabled) {
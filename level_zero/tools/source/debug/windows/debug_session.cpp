@@ -287,6 +287,7 @@ ze_result_t DebugSessionWindows::handleEuAttentionBitsEvent(DBGUMD_READ_EVENT_EU
                 PRINT_DEBUGGER_THREAD_LOG("ATTENTION event for thread: %s\n", EuThread::toString(threadId).c_str());
                 addThreadToNewlyStoppedFromRaisedAttention(threadId, memoryHandle, stateSaveAreaMemory.data());
             }
+            setStateSaveAreaSnapshot(memoryHandle, stateSaveAreaMemory.data(), stateSaveAreaSize);
         }
     }
 
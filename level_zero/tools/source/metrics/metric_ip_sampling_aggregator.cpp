@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/tools/source/metrics/metric_ip_sampling_aggregator.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+
+#include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
+#include "level_zero/tools/source/metrics/metric_ip_sampling_source.h"
+
+#include <algorithm>
+#include <array>
+
+namespace L0 {
+
+IpSamplingStallAggregator::IpSamplingStallAggregator(const L0GfxCoreHelper &l0GfxCoreHelper, uint32_t metricCount)
+    : l0GfxCoreHelper(l0GfxCoreHelper), metricCount(metricCount), stallCounterCount(metricCount - 1) {
+    UNRECOVERABLE_IF(metricCount == 0 || stallCounterCount > maxStallSamplingReportCounterCount);
+    slots.resize(initialIpCapacity * 2, emptySlot);
+    ips.reserve(initialIpCapacity);
+    stallCounts.reserve(initialIpCapacity * stallCounterCount);
+}
+
+size_t IpSamplingStallAggregator::getSlotIndex(uint64_t ip) const {
+    // Fibonacci hashing, slot count is power of 2
+    return static_cast<size_t>((ip * 0x9E3779B97F4A7C15ull) >> 32) & (slots.size() - 1);
+}
+
+void IpSamplingStallAggregator::rehash(size_t newSlotCount) {
+    slots.assign(newSlotCount, emptySlot);
+    for (uint32_t entry = 0; entry < ips.size(); entry++) {
+        auto slotIndex = getSlotIndex(ips[entry]);
+        while (slots[slotIndex] != emptySlot) {
+            slotIndex = (slotIndex + 1) & (slots.size() - 1);
+        }
+        slots[slotIndex] = entry;
+    }
+}
+
+uint64_t *IpSamplingStallAggregator::getStallCounts(uint64_t ip) {
+    auto slotIndex = getSlotIndex(ip);
+    while (slots[slotIndex] != emptySlot) {
+        const auto entry = slots[slotIndex];
+        if (ips[entry] == ip) {
+            return &stallCounts[static_cast<size_t>(entry) * stallCounterCount];
+        }
+        slotIndex = (slotIndex + 1) & (slots.size() - 1);
+    }
+
+    const auto entry = static_cast<uint32_t>(ips.size());
+    ips.push_back(ip);
+    stallCounts.resize(stallCounts.size() + stallCounterCount, 0u);
+    slots[slotIndex] = entry;
+
+    // Keep load factor at most 1/2, so probe sequences stay short
+    if (ips.size() * 2 > slots.size()) {
+        rehash(slots.size() * 2);
+    }
+    return &stallCounts[static_cast<size_t>(entry) * stallCounterCount];
+}
+
+ze_result_t IpSamplingStallAggregator::addRawReports(const size_t rawDataSize, const uint8_t *pRawData) {
+    const uint32_t rawReportSize = IpSamplingMetricGroupBase::rawReportSize;
+    if ((rawDataSize % rawReportSize) != 0) {
+        return ZE_RESULT_ERROR_INVALID_SIZE;
+    }
+
+    std::array<uint64_t, maxStallSamplingReportCounterCount> reportStallCounts = {};
+    for (const uint8_t *pRawIpData = pRawData; pRawIpData < pRawData + rawDataSize; pRawIpData += rawReportSize) {
+        uint64_t ip = 0;
+        dataDropped |= l0GfxCoreHelper.stallIpDataDecode(pRawIpData, ip, reportStallCounts.data());
+
+        auto ipStallCounts = getStallCounts(ip);
+        for (uint32_t i = 0; i < stallCounterCount; i++) {
+            ipStallCounts[i] += reportStallCounts[i];
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+void IpSamplingStallAggregator::getMetricValues(uint32_t &metricValueCount, zet_typed_value_t *pMetricValues) const {
+    metricValueCount = std::min(metricValueCount, getMetricValueCount());
+
+    std::vector<uint32_t> sortedEntries(ips.size());
+    for (uint32_t entry = 0; entry < sortedEntries.size(); entry++) {
+        sortedEntries[entry] = entry;
+    }
+    std::sort(sortedEntries.begin(), sortedEntries.end(), [this](uint32_t left, uint32_t right) {
+        return ips[left] < ips[right];
+    });
+
+    uint32_t valueIndex = 0;
+    for (auto entry : sortedEntries) {
+        if (valueIndex >= metricValueCount) {
+            break;
+        }
+        pMetricValues[valueIndex].type = ZET_VALUE_TYPE_UINT64;
+        pMetricValues[valueIndex].value.ui64 = ips[entry];
+        valueIndex++;
+
+        const auto ipStallCounts = &stallCounts[static_cast<size_t>(entry) * stallCounterCount];
+        for (uint32_t i = 0; (i < stallCounterCount) && (valueIndex < metricValueCount); i++, valueIndex++) {
+            pMetricValues[valueIndex].type = ZET_VALUE_TYPE_UINT64;
+            pMetricValues[valueIndex].value.ui64 = ipStallCounts[i];
+        }
+    }
+}
+
+void IpSamplingStallAggregator::reset() {
+    ips.clear();
+    stallCounts.clear();
+    slots.assign(slots.size(), emptySlot);
+    dataDropped = false;
+}
+
+} // namespace L0
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <level_zero/zet_api.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace L0 {
+class L0GfxCoreHelper;
+
+// Sums stall counters of raw IP sampling reports per IP. IPs are kept in an open addressing table
+// with linear probing, and counters of all IPs live in one preallocated array, so aggregating a report
+// does not allocate. Raw data can be added in chunks, e.g. as they are read from the streamer.
+class IpSamplingStallAggregator : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t initialIpCapacity = 512u;
+
+    IpSamplingStallAggregator(const L0GfxCoreHelper &l0GfxCoreHelper, uint32_t metricCount);
+
+    ze_result_t addRawReports(const size_t rawDataSize, const uint8_t *pRawData);
+    // Values are ordered by IP, every IP produces metricCount values
+    void getMetricValues(uint32_t &metricValueCount, zet_typed_value_t *pMetricValues) const;
+    uint32_t getMetricValueCount() const { return getIpCount() * metricCount; }
+    uint32_t getIpCount() const { return static_cast<uint32_t>(ips.size()); }
+    bool isDataDropped() const { return dataDropped; }
+    void reset();
+
+  protected:
+    static constexpr uint32_t emptySlot = UINT32_MAX;
+
+    uint64_t *getStallCounts(uint64_t ip);
+    void rehash(size_t newSlotCount);
+    size_t getSlotIndex(uint64_t ip) const;
+
+    const L0GfxCoreHelper &l0GfxCoreHelper;
+    const uint32_t metricCount;
+    const uint32_t stallCounterCount;
+    std::vector<uint32_t> slots;
+    std::vector<uint64_t> ips;
+    std::vector<uint64_t> stallCounts;
+    bool dataDropped = false;
+};
+
+} // namespace L0
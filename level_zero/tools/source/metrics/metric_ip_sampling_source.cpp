@@ -17,6 +17,7 @@
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/include/zet_intel_gpu_metric.h"
 #include "level_zero/tools/source/metrics/metric.h"
+#include "level_zero/tools/source/metrics/metric_ip_sampling_aggregator.h"
 #include "level_zero/tools/source/metrics/metric_ip_sampling_streamer.h"
 #include "level_zero/tools/source/metrics/os_interface_metric.h"
 #include <level_zero/zet_api.h>
@@ -425,9 +426,6 @@ ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric
 ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric_group_calculation_type_t type, const size_t rawDataSize, const uint8_t *pRawData,
                                                                 uint32_t &metricValueCount,
                                                                 zet_typed_value_t *pCalculatedData) {
-    bool dataOverflow = false;
-    std::map<uint64_t, void *> stallReportDataMap;
-
     // MAX_METRIC_VALUES is not supported yet.
     if (type != ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
@@ -435,35 +433,20 @@ ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric
 
     DEBUG_BREAK_IF(pCalculatedData == nullptr);
 
-    const uint32_t rawReportSize = IpSamplingMetricGroupBase::rawReportSize;
-
-    if ((rawDataSize % rawReportSize) != 0) {
-        return ZE_RESULT_ERROR_INVALID_SIZE;
+    auto stallAggregator = createStallAggregator();
+    const auto result = stallAggregator->addRawReports(rawDataSize, pRawData);
+    if (result != ZE_RESULT_SUCCESS) {
+        return result;
     }
 
-    const uint32_t rawReportCount = static_cast<uint32_t>(rawDataSize) / rawReportSize;
+    stallAggregator->getMetricValues(metricValueCount, pCalculatedData);
+    return stallAggregator->isDataDropped() ? ZE_RESULT_WARNING_DROPPED_DATA : ZE_RESULT_SUCCESS;
+}
 
+std::unique_ptr<IpSamplingStallAggregator> IpSamplingMetricGroupImp::createStallAggregator() {
     DeviceImp *deviceImp = static_cast<DeviceImp *>(&this->getMetricSource().getMetricDeviceContext().getDevice());
     auto &l0GfxCoreHelper = deviceImp->getNEODevice()->getRootDeviceEnvironment().getHelper<L0GfxCoreHelper>();
-
-    for (const uint8_t *pRawIpData = pRawData; pRawIpData < pRawData + (rawReportCount * rawReportSize); pRawIpData += rawReportSize) {
-        dataOverflow |= l0GfxCoreHelper.stallIpDataMapUpdate(stallReportDataMap, pRawIpData);
-    }
-
-    metricValueCount = std::min<uint32_t>(metricValueCount, static_cast<uint32_t>(stallReportDataMap.size()) * properties.metricCount);
-    std::vector<zet_typed_value_t> ipDataValues;
-    uint32_t i = 0;
-    for (auto it = stallReportDataMap.begin(); it != stallReportDataMap.end(); ++it) {
-        l0GfxCoreHelper.stallSumIpDataToTypedValues(it->first, it->second, ipDataValues);
-        for (auto jt = ipDataValues.begin(); (jt != ipDataValues.end()) && (i < metricValueCount); jt++, i++) {
-            *(pCalculatedData + i) = *jt;
-        }
-        ipDataValues.clear();
-    }
-    l0GfxCoreHelper.stallIpDataMapDelete(stallReportDataMap);
-    stallReportDataMap.clear();
-
-    return dataOverflow ? ZE_RESULT_WARNING_DROPPED_DATA : ZE_RESULT_SUCCESS;
+    return std::make_unique<IpSamplingStallAggregator>(l0GfxCoreHelper, properties.metricCount);
 }
 
 zet_metric_group_handle_t IpSamplingMetricGroupImp::getMetricGroupForSubDevice(const uint32_t subDeviceIndex) {
@@ -15,6 +15,7 @@ namespace L0 {
 struct IpSamplingMetricImp;
 struct IpSamplingMetricGroupImp;
 struct IpSamplingMetricStreamerImp;
+class IpSamplingStallAggregator;
 
 class IpSamplingMetricSourceImp : public MetricSource {
 
@@ -112,6 +113,7 @@ struct IpSamplingMetricGroupImp : public IpSamplingMetricGroupBase {
     ze_result_t getCalculatedMetricValues(const zet_metric_group_calculation_type_t type, const size_t rawDataSize, const uint8_t *pMultiMetricData,
                                           uint32_t &metricValueCount,
                                           zet_typed_value_t *pCalculatedData, const uint32_t setIndex);
+    std::unique_ptr<IpSamplingStallAggregator> createStallAggregator();
 
   private:
     std::vector<std::unique_ptr<IpSamplingMetricImp>> metrics = {};
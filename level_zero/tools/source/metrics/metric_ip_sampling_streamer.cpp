@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,12 +7,17 @@
 
 #include "level_zero/tools/source/metrics/metric_ip_sampling_streamer.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/string.h"
+
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/tools/source/metrics/metric.h"
 #include "level_zero/tools/source/metrics/metric_ip_sampling_source.h"
 #include "level_zero/tools/source/metrics/os_interface_metric.h"
 #include <level_zero/zet_api.h>
 
+#include <chrono>
 #include <string.h>
 
 namespace L0 {
@@ -44,6 +49,7 @@ ze_result_t IpSamplingMetricGroupImp::streamerOpen(
     if (result == ZE_RESULT_SUCCESS) {
         source.pActiveStreamer = pStreamerImp;
         pStreamerImp->attachEvent(hNotificationEvent);
+        pStreamerImp->initDrainRing(desc->notifyEveryNReports);
     } else {
         delete pStreamerImp;
         pStreamerImp = nullptr;
@@ -68,11 +74,15 @@ ze_result_t IpSamplingMetricStreamerImp::readData(uint32_t maxReportCount, size_
         *pRawDataSize = std::min(maxSizeRequired, *pRawDataSize);
     }
 
+    if (drainRing) {
+        return drainRing->read(pRawData, pRawDataSize);
+    }
     return ipSamplingSource.getMetricOsInterface()->readData(pRawData, pRawDataSize);
 }
 
 ze_result_t IpSamplingMetricStreamerImp::close() {
 
+    drainRing.reset();
     const ze_result_t result = ipSamplingSource.getMetricOsInterface()->stopMeasurement();
     detachEvent();
     ipSamplingSource.pActiveStreamer = nullptr;
@@ -83,6 +93,13 @@ ze_result_t IpSamplingMetricStreamerImp::close() {
 
 Event::State IpSamplingMetricStreamerImp::getNotificationState() {
 
+    if (drainRing) {
+        const size_t notifySize = static_cast<size_t>(notifyEveryNReports) * ipSamplingSource.getMetricOsInterface()->getUnitReportSize();
+        return drainRing->getAvailableSize() >= notifySize
+                   ? Event::State::STATE_SIGNALED
+                   : Event::State::STATE_INITIAL;
+    }
+
     return ipSamplingSource.getMetricOsInterface()->isNReportsAvailable()
                ? Event::State::STATE_SIGNALED
                : Event::State::STATE_INITIAL;
@@ -94,6 +111,87 @@ uint32_t IpSamplingMetricStreamerImp::getMaxSupportedReportCount() {
     return ipSamplingSource.getMetricOsInterface()->getRequiredBufferSize(UINT32_MAX) / unitReportSize;
 }
 
+void IpSamplingMetricStreamerImp::initDrainRing(uint32_t notifyEveryNReports) {
+    const auto drainBufferSizeKb = NEO::debugManager.flags.IpSamplingDrainBufferSize.get();
+    if (drainBufferSizeKb <= 0) {
+        return;
+    }
+    this->notifyEveryNReports = std::max(notifyEveryNReports, 1u);
+    drainRing = std::make_unique<IpSamplingDrainRing>(*ipSamplingSource.getMetricOsInterface(), static_cast<size_t>(drainBufferSizeKb) * MemoryConstants::kiloByte);
+    drainRing->start();
+}
+
+IpSamplingDrainRing::IpSamplingDrainRing(MetricIpSamplingOsInterface &osInterface, size_t ringSize)
+    : osInterface(osInterface), unitReportSize(osInterface.getUnitReportSize()),
+      drainTask([this]() { this->drain(); }, std::chrono::microseconds(drainPeriodUs)) {
+    UNRECOVERABLE_IF(unitReportSize == 0);
+    ring.resize(std::max(ringSize - ringSize % unitReportSize, static_cast<size_t>(unitReportSize)));
+}
+
+IpSamplingDrainRing::~IpSamplingDrainRing() {
+    stop();
+}
+
+ze_result_t IpSamplingDrainRing::drain() {
+    uint8_t *pWriteData = nullptr;
+    size_t writeSize = 0;
+    {
+        std::lock_guard<std::mutex> lock(ringMutex);
+        if (availableSize == ring.size()) {
+            return ZE_RESULT_SUCCESS;
+        }
+        const size_t writeOffset = (readOffset + availableSize) % ring.size();
+        writeSize = std::min(ring.size() - availableSize, ring.size() - writeOffset);
+        pWriteData = ring.data() + writeOffset;
+    }
+
+    // Free part of the ring is not accessed by readers, so kernel data is read into it without lock
+    const auto result = osInterface.readData(pWriteData, &writeSize);
+
+    std::lock_guard<std::mutex> lock(ringMutex);
+    if (result != ZE_RESULT_SUCCESS) {
+        drainResult = result;
+        return result;
+    }
+    availableSize += writeSize - writeSize % unitReportSize;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t IpSamplingDrainRing::read(uint8_t *pRawData, size_t *pRawDataSize) {
+    std::lock_guard<std::mutex> lock(ringMutex);
+    if (drainResult != ZE_RESULT_SUCCESS) {
+        const auto result = drainResult;
+        drainResult = ZE_RESULT_SUCCESS;
+        *pRawDataSize = 0;
+        return result;
+    }
+
+    const size_t copySize = std::min(*pRawDataSize - *pRawDataSize % unitReportSize, availableSize);
+    const size_t firstCopySize = std::min(copySize, ring.size() - readOffset);
+    memcpy_s(pRawData, *pRawDataSize, ring.data() + readOffset, firstCopySize);
+    if (copySize > firstCopySize) {
+        memcpy_s(pRawData + firstCopySize, *pRawDataSize - firstCopySize, ring.data(), copySize - firstCopySize);
+    }
+
+    readOffset = (readOffset + copySize) % ring.size();
+    availableSize -= copySize;
+    *pRawDataSize = copySize;
+    return ZE_RESULT_SUCCESS;
+}
+
+size_t IpSamplingDrainRing::getAvailableSize() {
+    std::lock_guard<std::mutex> lock(ringMutex);
+    return availableSize;
+}
+
+void IpSamplingDrainRing::start() {
+    drainTask.start();
+}
+
+void IpSamplingDrainRing::stop() {
+    drainTask.stop();
+}
+
 ze_result_t MultiDeviceIpSamplingMetricGroupImp::streamerOpen(
     zet_context_handle_t hContext,
     zet_device_handle_t hDevice,
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,13 +7,49 @@
 
 #pragma once
 
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/periodic_task.h"
+
 #include "level_zero/tools/source/metrics/metric.h"
 #include "level_zero/tools/source/metrics/os_interface_metric.h"
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace L0 {
 
 class IpSamplingMetricSourceImp;
 
+// Ring of raw reports, which background thread keeps filling from OS interface, so kernel buffers are
+// drained even when application reads rarely. Only the drain thread writes into free part of the ring,
+// readers copy from used part, offsets are updated under lock.
+class IpSamplingDrainRing : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t drainPeriodUs = 1000u;
+
+    IpSamplingDrainRing(MetricIpSamplingOsInterface &osInterface, size_t ringSize);
+    ~IpSamplingDrainRing();
+
+    void start();
+    void stop();
+    ze_result_t drain();
+    ze_result_t read(uint8_t *pRawData, size_t *pRawDataSize);
+    size_t getAvailableSize();
+    size_t getRingSize() const { return ring.size(); }
+
+  protected:
+    MetricIpSamplingOsInterface &osInterface;
+    const uint32_t unitReportSize;
+    std::vector<uint8_t> ring;
+    size_t readOffset = 0;
+    size_t availableSize = 0;
+    ze_result_t drainResult = ZE_RESULT_SUCCESS;
+    std::mutex ringMutex;
+
+    NEO::PeriodicTask drainTask;
+};
+
 struct IpSamplingMetricStreamerBase : public MetricStreamer {
     ze_result_t appendStreamerMarker(CommandList &commandList, uint32_t value) override { return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE; }
 };
@@ -26,9 +62,12 @@ struct IpSamplingMetricStreamerImp : public IpSamplingMetricStreamerBase {
     ze_result_t close() override;
     Event::State getNotificationState() override;
     uint32_t getMaxSupportedReportCount();
+    void initDrainRing(uint32_t notifyEveryNReports);
 
   protected:
     IpSamplingMetricSourceImp &ipSamplingSource;
+    std::unique_ptr<IpSamplingDrainRing> drainRing;
+    uint32_t notifyEveryNReports = 1;
 };
 
 struct MultiDeviceIpSamplingMetricStreamerImp : public IpSamplingMetricStreamerBase {
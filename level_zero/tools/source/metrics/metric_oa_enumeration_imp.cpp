@@ -11,6 +11,7 @@
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/os_interface/os_library.h"
+#include "shared/source/os_interface/os_thread.h"
 
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/tools/source/metrics/metric_oa_query_imp.h"
@@ -808,13 +809,37 @@ ze_result_t OaMetricGroupImp::calculateMetricValuesExp(const zet_metric_group_ca
             UNRECOVERABLE_IF(*pSetCount > metricGroupCount);
             const uint32_t maxTotalMetricValueCount = *pTotalMetricValueCount;
             *pTotalMetricValueCount = 0;
+
+            std::vector<SubDeviceCalculation> subDeviceCalculations;
+            if (*pSetCount > 1 && NEO::debugManager.flags.MetricsCalculationConcurrentSubDevices.get() == 1) {
+                subDeviceCalculations.resize(*pSetCount);
+                for (size_t i = 0; i < *pSetCount; i++) {
+                    auto &calculation = subDeviceCalculations[i];
+                    calculation.metricGroup = static_cast<OaMetricGroupImp *>(metricGroups[i]);
+                    calculation.type = type;
+                    calculation.pRawData = pRawDataOffsetUnpacked + pRawDataOffsetsUnpacked[i];
+                    calculation.rawDataSize = pRawDataSizesUnpacked[i];
+                    calculation.metricValueCount = maxTotalMetricValueCount;
+                }
+                calculateSubDeviceMetricValues(subDeviceCalculations);
+            }
+
             for (size_t i = 0; i < *pSetCount; i++) {
                 auto &metricGroup = *static_cast<OaMetricGroupImp *>(metricGroups[i]);
                 const uint32_t dataSize = pRawDataSizesUnpacked[i];
                 const uint8_t *pRawDataOffset = pRawDataOffsetUnpacked + pRawDataOffsetsUnpacked[i];
 
                 pMetricCounts[i] = maxTotalMetricValueCount;
-                result = metricGroup.getCalculatedMetricValues(type, dataSize, pRawDataOffset, pMetricCounts[i], pMetricValues);
+                if (subDeviceCalculations.empty()) {
+                    result = metricGroup.getCalculatedMetricValues(type, dataSize, pRawDataOffset, pMetricCounts[i], pMetricValues);
+                } else {
+                    const auto &calculation = subDeviceCalculations[i];
+                    result = calculation.result;
+                    if (result == ZE_RESULT_SUCCESS) {
+                        pMetricCounts[i] = calculation.metricValueCount;
+                        std::copy_n(calculation.values.begin(), calculation.metricValueCount, pMetricValues);
+                    }
+                }
 
                 if (result == ZE_RESULT_NOT_READY) {
                     pMetricCounts[i] = 0;
@@ -848,6 +873,32 @@ ze_result_t OaMetricGroupImp::calculateMetricValuesExp(const zet_metric_group_ca
     return result;
 }
 
+void *OaMetricGroupImp::subDeviceCalculationThreadFunction(void *arg) {
+    auto calculation = reinterpret_cast<SubDeviceCalculation *>(arg);
+    uint32_t expectedMetricValueCount = 0;
+    calculation->result = calculation->metricGroup->getCalculatedMetricCount(calculation->rawDataSize, expectedMetricValueCount);
+    if (calculation->result == ZE_RESULT_SUCCESS) {
+        calculation->metricValueCount = std::min(calculation->metricValueCount, expectedMetricValueCount);
+        calculation->values.resize(calculation->metricValueCount);
+        calculation->result = calculation->metricGroup->getCalculatedMetricValues(calculation->type, calculation->rawDataSize, calculation->pRawData,
+                                                                                  calculation->metricValueCount, calculation->values.data());
+    }
+    return nullptr;
+}
+
+void OaMetricGroupImp::calculateSubDeviceMetricValues(std::vector<SubDeviceCalculation> &calculations) {
+    // Every sub device group calculates with metric set of its own metrics device, first one on the caller's thread
+    std::vector<std::unique_ptr<NEO::Thread>> threads;
+    threads.reserve(calculations.size() - 1);
+    for (size_t i = 1; i < calculations.size(); i++) {
+        threads.push_back(NEO::Thread::create(subDeviceCalculationThreadFunction, reinterpret_cast<void *>(&calculations[i])));
+    }
+    subDeviceCalculationThreadFunction(&calculations[0]);
+    for (auto &thread : threads) {
+        thread->join();
+    }
+}
+
 ze_result_t OaMetricGroupImp::getMetricTimestampsExp(const ze_bool_t synchronizedWithHost,
                                                      uint64_t *globalTimestamp,
                                                      uint64_t *metricTimestamp) {
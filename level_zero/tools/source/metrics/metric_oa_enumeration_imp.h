@@ -210,6 +210,18 @@ struct OaMetricGroupImp : public MetricGroupImp {
                                           zet_typed_value_t *pCalculatedData);
     ze_result_t getExportDataHeapSize(size_t &exportDataHeapSize);
 
+    struct SubDeviceCalculation {
+        OaMetricGroupImp *metricGroup = nullptr;
+        zet_metric_group_calculation_type_t type = ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES;
+        const uint8_t *pRawData = nullptr;
+        uint32_t rawDataSize = 0;
+        uint32_t metricValueCount = 0;
+        std::vector<zet_typed_value_t> values;
+        ze_result_t result = ZE_RESULT_ERROR_UNKNOWN;
+    };
+    static void calculateSubDeviceMetricValues(std::vector<SubDeviceCalculation> &calculations);
+    static void *subDeviceCalculationThreadFunction(void *arg);
+
     // Cached metrics.
     std::vector<Metric *> metrics;
     zet_metric_group_properties_t properties = {ZET_STRUCTURE_TYPE_METRIC_GROUP_PROPERTIES, nullptr};
@@ -2721,6 +2721,94 @@ TEST_F(DebugSessionRegistersAccessTest, GivenBindlessSipVersion2WhenCallingResum
     EXPECT_EQ(1u, session->writeResumeCommandCalled);
 }
 
+TEST_F(DebugSessionRegistersAccessTest, givenStateSaveAreaSnapshotEnabledWhenReadingRegistersOfStoppedThreadsThenStateSaveAreaIsReadOnce) {
+    session->stateSaveAreaHeader.resize(session->getContextStateSaveAreaSize(0));
+    session->stateSaveAreaSnapshotEnabled = true;
+
+    EuThread::ThreadId thread0(0, 0, 0, 0, 0);
+    EuThread::ThreadId thread3(0, 0, 0, 0, 3);
+    ze_device_thread_t apiThread3 = {0, 0, 0, 3};
+    session->allThreads[thread3]->stopThread(1u);
+    session->allThreads[thread3]->reportAsStopped();
+
+    auto *regdesc = &(reinterpret_cast<SIP::StateSaveAreaHeader *>(session->stateSaveAreaHeader.data()))->regHeader.grf;
+    std::vector<uint8_t> r0(regdesc->bytes, 0xa0);
+    std::vector<uint8_t> r0Thread3(regdesc->bytes, 0xa3);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->registersAccessHelper(session->allThreads[thread0].get(), regdesc, 0, 1, r0.data(), true));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->registersAccessHelper(session->allThreads[thread3].get(), regdesc, 0, 1, r0Thread3.data(), true));
+
+    std::vector<uint8_t> readValues(regdesc->bytes, 0);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, readValues.data()));
+    EXPECT_EQ(r0, readValues);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readRegisters(apiThread3, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, readValues.data()));
+    EXPECT_EQ(r0Thread3, readValues);
+
+    EXPECT_EQ(1u, session->readGpuMemoryCallCount);
+    EXPECT_EQ(1u, session->stateSaveAreaSnapshots.size());
+}
+
+TEST_F(DebugSessionRegistersAccessTest, givenStateSaveAreaSnapshotWhenRegistersAreWrittenAndThreadResumedThenSnapshotIsUpdatedAndInvalidated) {
+    session->stateSaveAreaHeader.resize(session->getContextStateSaveAreaSize(0));
+    session->stateSaveAreaSnapshotEnabled = true;
+
+    auto *regdesc = &(reinterpret_cast<SIP::StateSaveAreaHeader *>(session->stateSaveAreaHeader.data()))->regHeader.grf;
+    std::vector<uint8_t> readValues(regdesc->bytes, 0);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, readValues.data()));
+    EXPECT_EQ(1u, session->stateSaveAreaSnapshots.size());
+
+    std::vector<uint8_t> r0(regdesc->bytes, 0x5c);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->writeRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, r0.data()));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, readValues.data()));
+    EXPECT_EQ(r0, readValues);
+    EXPECT_EQ(1u, session->readGpuMemoryCallCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->resume(stoppedThread));
+    EXPECT_EQ(0u, session->stateSaveAreaSnapshots.size());
+}
+
+TEST_F(DebugSessionRegistersAccessTest, givenStateSaveAreaSnapshotWhenAnotherThreadStopsThenSnapshotIsInvalidatedAndRegistersOfNewlyStoppedThreadAreReadAgain) {
+    session->stateSaveAreaHeader.resize(session->getContextStateSaveAreaSize(0));
+    session->stateSaveAreaSnapshotEnabled = true;
+
+    EuThread::ThreadId thread3(0, 0, 0, 0, 3);
+    ze_device_thread_t apiThread3 = {0, 0, 0, 3};
+    auto memoryHandle = session->allThreads[stoppedThreadId]->getMemoryHandle();
+
+    auto *regdesc = &(reinterpret_cast<SIP::StateSaveAreaHeader *>(session->stateSaveAreaHeader.data()))->regHeader.grf;
+    std::vector<uint8_t> r0Running(regdesc->bytes, 0x11);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->registersAccessHelper(session->allThreads[thread3].get(), regdesc, 0, 1, r0Running.data(), true));
+
+    std::vector<uint8_t> readValues(regdesc->bytes, 0);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, readValues.data()));
+    EXPECT_EQ(1u, session->stateSaveAreaSnapshots.size());
+
+    std::vector<uint8_t> r0Stopped(regdesc->bytes, 0x33);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->registersAccessHelper(session->allThreads[thread3].get(), regdesc, 0, 1, r0Stopped.data(), true));
+    session->addThreadToNewlyStoppedFromRaisedAttention(thread3, memoryHandle, session->stateSaveAreaHeader.data());
+    ASSERT_TRUE(session->allThreads[thread3]->isStopped());
+    EXPECT_EQ(0u, session->stateSaveAreaSnapshots.size());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readRegisters(apiThread3, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, readValues.data()));
+    EXPECT_EQ(r0Stopped, readValues);
+    EXPECT_EQ(2u, session->readGpuMemoryCallCount);
+}
+
+TEST_F(DebugSessionRegistersAccessTest, givenStateSaveAreaSnapshotWhenSettingNewSnapshotForStopEventThenRegistersAreReadFromIt) {
+    session->stateSaveAreaHeader.resize(session->getContextStateSaveAreaSize(0));
+    session->stateSaveAreaSnapshotEnabled = true;
+
+    auto *regdesc = &(reinterpret_cast<SIP::StateSaveAreaHeader *>(session->stateSaveAreaHeader.data()))->regHeader.grf;
+    auto startRegOffset = session->calculateThreadSlotOffset(stoppedThreadId) + session->calculateRegisterOffsetInThreadSlot(regdesc, 0);
+    std::vector<char> stateSaveArea(session->stateSaveAreaHeader.begin(), session->stateSaveAreaHeader.end());
+    memset(stateSaveArea.data() + startRegOffset, 0x7e, regdesc->bytes);
+    session->setStateSaveAreaSnapshot(session->allThreads[stoppedThreadId]->getMemoryHandle(), stateSaveArea.data(), stateSaveArea.size());
+
+    std::vector<uint8_t> readValues(regdesc->bytes, 0);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, readValues.data()));
+    EXPECT_EQ(std::vector<uint8_t>(regdesc->bytes, 0x7e), readValues);
+    EXPECT_EQ(0u, session->readGpuMemoryCallCount);
+}
+
 TEST_F(DebugSessionRegistersAccessTestV3, WhenReadingDebugScratchRegisterThenErrorsHandled) {
     uint64_t scratch[2];
     EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, session->readDebugScratchRegisters(5, 0, scratch));
@@ -144,6 +144,8 @@ struct MockDebugSessionLinuxi915 : public L0::DebugSessionLinuxi915 {
     using L0::DebugSessionImp::newAttentionRaised;
     using L0::DebugSessionImp::sipSupportsSlm;
     using L0::DebugSessionImp::stateSaveAreaHeader;
+    using L0::DebugSessionImp::stateSaveAreaSnapshotEnabled;
+    using L0::DebugSessionImp::stateSaveAreaSnapshots;
     using L0::DebugSessionImp::tileAttachEnabled;
     using L0::DebugSessionImp::tileSessions;
     using L0::DebugSessionImp::tileSessionsEnabled;
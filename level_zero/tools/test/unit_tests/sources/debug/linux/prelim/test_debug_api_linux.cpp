@@ -5487,6 +5487,63 @@ TEST_F(DebugApiLinuxTest, GivenStoppedAndRunningThreadWhenCheckStoppedThreadsAnd
     EXPECT_EQ(thread1.thread, event.info.thread.thread.thread);
 }
 
+TEST_F(DebugApiLinuxTest, GivenStateSaveAreaSnapshotEnabledWhenCheckStoppedThreadsAndGenerateEventsCalledForMultipleThreadsThenSrIdentsAreReadFromSingleStateSaveAreaRead) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.EnableDebuggerStateSaveAreaSnapshot.set(1);
+
+    zet_debug_config_t config = {};
+    config.pid = 0x1234;
+    const auto memoryHandle = 1u;
+
+    auto sessionMock = std::make_unique<MockDebugSessionLinuxi915>(config, device, 10);
+    ASSERT_NE(nullptr, sessionMock);
+    SIP::version version = {2, 0, 0};
+    initStateSaveArea(sessionMock->stateSaveAreaHeader, version, device);
+
+    auto handler = new MockIoctlHandlerI915;
+    sessionMock->ioctlHandler.reset(handler);
+    handler->setPreadMemory(sessionMock->stateSaveAreaHeader.data(), sessionMock->stateSaveAreaHeader.size(), 0x1000);
+
+    DebugSessionLinuxi915::BindInfo cssaInfo = {0x1000, sessionMock->stateSaveAreaHeader.size()};
+    sessionMock->clientHandleToConnection[MockDebugSessionLinuxi915::mockClientHandle]->vmToContextStateSaveAreaBindInfo[memoryHandle] = cssaInfo;
+
+    EuThread::ThreadId thread = {0, 0, 0, 0, 0};
+    EuThread::ThreadId thread1 = {0, 0, 0, 0, 1};
+
+    sessionMock->allThreads[thread.packed]->stopThread(memoryHandle);
+    sessionMock->allThreads[thread.packed]->reportAsStopped();
+
+    std::vector<EuThread::ThreadId> threads;
+    threads.push_back(thread);
+    threads.push_back(thread1);
+
+    for (auto thread : threads) {
+        sessionMock->stoppedThreads[thread.packed] = 3;
+    }
+
+    std::unique_ptr<uint8_t[]> bitmask;
+    size_t bitmaskSize = 0;
+    auto &hwInfo = neoDevice->getHardwareInfo();
+    auto &l0GfxCoreHelper = neoDevice->getRootDeviceEnvironment().getHelper<L0GfxCoreHelper>();
+    l0GfxCoreHelper.getAttentionBitmaskForSingleThreads(threads, hwInfo, bitmask, bitmaskSize);
+
+    handler->outputBitmaskSize = bitmaskSize;
+    handler->outputBitmask = std::move(bitmask);
+
+    sessionMock->checkStoppedThreadsAndGenerateEvents(threads, memoryHandle, 0);
+
+    EXPECT_EQ(2u, sessionMock->readSystemRoutineIdentFromMemoryCallCount);
+    EXPECT_EQ(0u, sessionMock->readSystemRoutineIdentCallCount);
+
+    EXPECT_TRUE(sessionMock->allThreads[thread.packed]->isStopped());
+    EXPECT_TRUE(sessionMock->allThreads[thread1.packed]->isStopped());
+
+    EXPECT_EQ(1u, sessionMock->apiEvents.size());
+    auto event = sessionMock->apiEvents.front();
+    EXPECT_EQ(ZET_DEBUG_EVENT_TYPE_THREAD_STOPPED, event.type);
+    EXPECT_EQ(thread1.thread, event.info.thread.thread.thread);
+}
+
 TEST_F(DebugApiLinuxTest, GivenStoppedThreadResumeCausingPageFaultAndFEBitSetWhenCheckStoppedThreadsAndGenerateEventsCalledThenThreadStoppedEventIsNotGenerated) {
     zet_debug_config_t config = {};
     config.pid = 0x1234;
@@ -7323,6 +7380,47 @@ TEST_F(DebugApiRegistersAccessTest, givenReadRegistersCalledCorrectValuesRead) {
     }
 }
 
+TEST_F(DebugApiRegistersAccessTest, givenStateSaveAreaSnapshotWhenResumedThreadIsStoppedAgainThenRegistersAreNotReadFromSnapshot) {
+    SIP::version version = {1, 0, 0};
+    initStateSaveArea(session->stateSaveAreaHeader, version, device);
+    ioctlHandler = new MockIoctlHandlerI915;
+    ioctlHandler->mmapRet = session->stateSaveAreaHeader.data();
+    ioctlHandler->mmapBase = stateSaveAreaGpuVa;
+
+    ioctlHandler->setPreadMemory(session->stateSaveAreaHeader.data(), session->stateSaveAreaHeader.size(), stateSaveAreaGpuVa);
+    ioctlHandler->setPwriteMemory(session->stateSaveAreaHeader.data(), session->stateSaveAreaHeader.size(), stateSaveAreaGpuVa);
+
+    session->ioctlHandler.reset(ioctlHandler);
+    session->vmHandle = vmHandle;
+    session->stateSaveAreaSnapshotEnabled = true;
+    session->skipCheckForceExceptionBit = true;
+
+    ze_device_thread_t thread = {0, 0, 0, 1};
+    EuThread::ThreadId threadId{0, thread};
+    session->allThreads[threadId]->verifyStopped(1);
+    session->allThreads[threadId]->stopThread(vmHandle);
+    session->allThreads[threadId]->resumeThread();
+
+    // snapshot seeded for another thread while this thread runs holds its old registers
+    std::vector<char> snapshot(session->stateSaveAreaHeader.begin(), session->stateSaveAreaHeader.end());
+    auto pStateSaveAreaHeader = reinterpret_cast<SIP::StateSaveAreaHeader *>(session->stateSaveAreaHeader.data());
+    auto grfOffset = threadSlotOffset(pStateSaveAreaHeader, 0, 0, 0, 1) + regOffsetInThreadSlot(&pStateSaveAreaHeader->regHeader.grf, 0);
+    memset(snapshot.data() + grfOffset, 'x', 32);
+    session->stateSaveAreaSnapshots[vmHandle] = snapshot;
+
+    session->stoppedThreads[threadId.packed] = 3;
+    session->checkStoppedThreadsAndGenerateEvents({threadId}, vmHandle, 0);
+    ASSERT_TRUE(session->allThreads[threadId]->isStopped());
+    EXPECT_EQ(0u, session->stateSaveAreaSnapshots.count(vmHandle));
+    session->allThreads[threadId]->reportAsStopped();
+
+    char grf[32] = {0};
+    char grfRef[32] = {0};
+    memset(grfRef, 'a', 32);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zetDebugReadRegisters(session->toHandle(), thread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, grf));
+    EXPECT_EQ(0, memcmp(grf, grfRef, 32));
+}
+
 TEST_F(DebugApiRegistersAccessTest, givenInvalidClientHandleWhenWriteRegistersCalledThenErrorIsReturned) {
     session->clientHandle = MockDebugSessionLinuxi915::invalidClientHandle;
     EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, zetDebugWriteRegisters(session->toHandle(), {0, 0, 0, 0}, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, nullptr));
@@ -151,6 +151,7 @@ struct MockDebugSession : public L0::DebugSessionImp {
     using L0::DebugSessionImp::allocateStateSaveAreaMemory;
     using L0::DebugSessionImp::apiEvents;
     using L0::DebugSessionImp::applyResumeWa;
+    using L0::DebugSessionImp::calculateRegisterOffsetInThreadSlot;
     using L0::DebugSessionImp::calculateSrMagicOffset;
     using L0::DebugSessionImp::calculateThreadSlotOffset;
     using L0::DebugSessionImp::checkTriggerEventsForAttention;
@@ -169,6 +170,8 @@ struct MockDebugSession : public L0::DebugSessionImp {
     using L0::DebugSessionImp::resumeAccidentallyStoppedThreads;
     using L0::DebugSessionImp::sendInterrupts;
     using L0::DebugSessionImp::stateSaveAreaMemory;
+    using L0::DebugSessionImp::stateSaveAreaSnapshotEnabled;
+    using L0::DebugSessionImp::stateSaveAreaSnapshots;
     using L0::DebugSessionImp::typeToRegsetDesc;
     using L0::DebugSessionImp::validateAndSetStateSaveAreaHeader;
 
@@ -11,7 +11,9 @@
 
 #include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
+#include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/include/zet_intel_gpu_metric.h"
+#include "level_zero/tools/source/metrics/metric_ip_sampling_aggregator.h"
 #include "level_zero/tools/source/metrics/metric_ip_sampling_source.h"
 #include "level_zero/tools/source/metrics/metric_oa_source.h"
 #include "level_zero/tools/source/metrics/os_interface_metric.h"
@@ -1008,6 +1010,64 @@ HWTEST2_F(MetricIpSamplingCalculateMetricsTest, GivenEnumerationIsSuccessfulWith
     }
 }
 
+HWTEST2_F(MetricIpSamplingCalculateMetricsTest, GivenRawDataAddedInChunksWhenGettingMetricValuesFromStallAggregatorThenValuesMatchSingleCalculation, IsGen9ToPVC) {
+    auto &l0GfxCoreHelper = testDevices[0]->getNEODevice()->getRootDeviceEnvironment().getHelper<L0GfxCoreHelper>();
+    IpSamplingStallAggregator stallAggregator(l0GfxCoreHelper, l0GfxCoreHelper.getIpSamplingMetricCount());
+
+    const auto chunkSize = 2 * sizeof(rawDataVector[0]);
+    auto pRawData = reinterpret_cast<uint8_t *>(rawDataVector.data());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, stallAggregator.addRawReports(chunkSize, pRawData));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, stallAggregator.addRawReports(rawDataVectorSize - chunkSize, pRawData + chunkSize));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, stallAggregator.addRawReports(chunkSize - 1, pRawData));
+    EXPECT_FALSE(stallAggregator.isDataDropped());
+    EXPECT_EQ(2u, stallAggregator.getIpCount());
+    EXPECT_EQ(20u, stallAggregator.getMetricValueCount());
+
+    std::vector<zet_typed_value_t> metricValues(30);
+    uint32_t metricValueCount = static_cast<uint32_t>(metricValues.size());
+    stallAggregator.getMetricValues(metricValueCount, metricValues.data());
+    EXPECT_EQ(20u, metricValueCount);
+    for (uint32_t i = 0; i < metricValueCount; i++) {
+        EXPECT_EQ(expectedMetricValues[i].type, metricValues[i].type);
+        EXPECT_EQ(expectedMetricValues[i].value.ui64, metricValues[i].value.ui64);
+    }
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, stallAggregator.addRawReports(rawDataVectorOverflowSize, reinterpret_cast<uint8_t *>(rawDataVectorOverflow.data())));
+    EXPECT_TRUE(stallAggregator.isDataDropped());
+
+    stallAggregator.reset();
+    EXPECT_FALSE(stallAggregator.isDataDropped());
+    EXPECT_EQ(0u, stallAggregator.getMetricValueCount());
+}
+
+HWTEST2_F(MetricIpSamplingCalculateMetricsTest, GivenMoreIpsThanInitialCapacityWhenGettingMetricValuesFromStallAggregatorThenAllIpsAreReturnedInIpOrder, IsGen9ToPVC) {
+    auto &l0GfxCoreHelper = testDevices[0]->getNEODevice()->getRootDeviceEnvironment().getHelper<L0GfxCoreHelper>();
+    const auto metricCount = l0GfxCoreHelper.getIpSamplingMetricCount();
+    IpSamplingStallAggregator stallAggregator(l0GfxCoreHelper, metricCount);
+
+    const uint32_t ipCount = 4 * IpSamplingStallAggregator::initialIpCapacity;
+    std::vector<MockStallRawIpData> rawData;
+    for (uint32_t round = 0; round < 2; round++) {
+        for (uint32_t i = 0; i < ipCount; i++) {
+            const uint64_t ip = static_cast<uint64_t>(ipCount - i) * 0x40;
+            rawData.push_back({ip, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0});
+        }
+    }
+    EXPECT_EQ(ZE_RESULT_SUCCESS, stallAggregator.addRawReports(rawData.size() * sizeof(rawData[0]), reinterpret_cast<uint8_t *>(rawData.data())));
+    EXPECT_EQ(ipCount, stallAggregator.getIpCount());
+
+    std::vector<zet_typed_value_t> metricValues(stallAggregator.getMetricValueCount());
+    uint32_t metricValueCount = static_cast<uint32_t>(metricValues.size());
+    stallAggregator.getMetricValues(metricValueCount, metricValues.data());
+    EXPECT_EQ(ipCount * metricCount, metricValueCount);
+    for (uint32_t i = 0; i < ipCount; i++) {
+        EXPECT_EQ(static_cast<uint64_t>(i + 1) * 0x40, metricValues[i * metricCount].value.ui64);
+        for (uint32_t j = 1; j < metricCount; j++) {
+            EXPECT_EQ(2u, metricValues[i * metricCount + j].value.ui64);
+        }
+    }
+}
+
 HWTEST2_F(MetricIpSamplingEnumerationTest, GivenEnumerationIsSuccessfulWhenQueryPoolCreateIsCalledThenUnsupportedFeatureIsReturned, EustallSupportedPlatforms) {
 
     EXPECT_EQ(ZE_RESULT_SUCCESS, testDevices[0]->getMetricDeviceContext().enableMetricApi());
@@ -5,17 +5,22 @@
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/test_macros/test_base.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
 #include "level_zero/tools/source/metrics/metric_ip_sampling_source.h"
+#include "level_zero/tools/source/metrics/metric_ip_sampling_streamer.h"
 #include "level_zero/tools/source/metrics/metric_oa_source.h"
 #include "level_zero/tools/source/metrics/os_interface_metric.h"
 #include "level_zero/tools/test/unit_tests/sources/metrics/metric_ip_sampling_fixture.h"
 #include "level_zero/tools/test/unit_tests/sources/metrics/mock_metric_ip_sampling.h"
 #include <level_zero/zet_api.h>
 
+#include <chrono>
+#include <thread>
+
 namespace L0 {
 extern _ze_driver_handle_t *globalDriverHandle;
 
@@ -530,5 +535,105 @@ TEST_F(MetricIpSamplingStreamerTest, whenGetConcurrentMetricGroupsIsCalledThenCo
     }
 }
 
+TEST(IpSamplingDrainRingTest, givenDrainRingWhenDrainAndReadAreCalledThenReportsAreReturnedInOrderAcrossRingWrap) {
+    MockMetricIpSamplingOsInterface osInterface;
+    const size_t unitReportSize = osInterface.getUnitReportSize();
+    IpSamplingDrainRing drainRing(osInterface, 4 * unitReportSize + 1);
+    EXPECT_EQ(4 * unitReportSize, drainRing.getRingSize());
+
+    osInterface.isfillDataEnabled = true;
+    osInterface.fillDataSize = 3 * unitReportSize;
+    osInterface.fillData = 1;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, drainRing.drain());
+    EXPECT_EQ(3 * unitReportSize, drainRing.getAvailableSize());
+
+    std::vector<uint8_t> rawData(4 * unitReportSize);
+    size_t rawDataSize = 2 * unitReportSize + 1;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, drainRing.read(rawData.data(), &rawDataSize));
+    EXPECT_EQ(2 * unitReportSize, rawDataSize);
+    EXPECT_EQ(unitReportSize, drainRing.getAvailableSize());
+
+    // Only space up to the end of the ring is filled by single drain
+    osInterface.fillData = 2;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, drainRing.drain());
+    EXPECT_EQ(2 * unitReportSize, drainRing.getAvailableSize());
+    osInterface.fillData = 3;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, drainRing.drain());
+    EXPECT_EQ(4 * unitReportSize, drainRing.getAvailableSize());
+
+    osInterface.fillData = 4;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, drainRing.drain());
+    EXPECT_EQ(4 * unitReportSize, drainRing.getAvailableSize());
+
+    rawDataSize = rawData.size();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, drainRing.read(rawData.data(), &rawDataSize));
+    EXPECT_EQ(4 * unitReportSize, rawDataSize);
+    EXPECT_EQ(0u, drainRing.getAvailableSize());
+    for (size_t i = 0; i < rawDataSize; i++) {
+        const uint8_t expectedData = (i < unitReportSize) ? 1 : ((i < 2 * unitReportSize) ? 2 : 3);
+        EXPECT_EQ(expectedData, rawData[i]);
+    }
+}
+
+TEST(IpSamplingDrainRingTest, givenReadFromOsInterfaceFailsWhenDrainIsCalledThenErrorIsReturnedByNextReadOnly) {
+    MockMetricIpSamplingOsInterface osInterface;
+    const size_t unitReportSize = osInterface.getUnitReportSize();
+    IpSamplingDrainRing drainRing(osInterface, 4 * unitReportSize);
+
+    osInterface.readDataReturn = ZE_RESULT_ERROR_UNKNOWN;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, drainRing.drain());
+    EXPECT_EQ(0u, drainRing.getAvailableSize());
+
+    std::vector<uint8_t> rawData(unitReportSize);
+    size_t rawDataSize = rawData.size();
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, drainRing.read(rawData.data(), &rawDataSize));
+    EXPECT_EQ(0u, rawDataSize);
+
+    rawDataSize = rawData.size();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, drainRing.read(rawData.data(), &rawDataSize));
+    EXPECT_EQ(0u, rawDataSize);
+}
+
+TEST_F(MetricIpSamplingStreamerTest, givenDrainBufferIsEnabledWhenStreamerIsOpenThenReportsDrainedInBackgroundAreReturnedByReadData) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.IpSamplingDrainBufferSize.set(1);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, testDevices[0]->getMetricDeviceContext().enableMetricApi());
+    auto device = testDevices[1];
+    auto osInterface = osInterfaceVector[1];
+    const size_t unitReportSize = osInterface->getUnitReportSize();
+    osInterface->isfillDataEnabled = true;
+    osInterface->fillDataSize = 2 * unitReportSize;
+    osInterface->fillData = 5;
+
+    zet_metric_group_handle_t metricGroupHandle = MetricIpSamplingStreamerTest::getMetricGroup(device);
+    EXPECT_EQ(zetContextActivateMetricGroups(context->toHandle(), device, 1, &metricGroupHandle), ZE_RESULT_SUCCESS);
+
+    ze_event_handle_t eventHandle = {};
+    zet_metric_streamer_handle_t streamerHandle = {};
+    zet_metric_streamer_desc_t streamerDesc = {};
+    streamerDesc.stype = ZET_STRUCTURE_TYPE_METRIC_STREAMER_DESC;
+    streamerDesc.notifyEveryNReports = 1;
+    streamerDesc.samplingPeriod = 1000;
+    EXPECT_EQ(zetMetricStreamerOpen(context->toHandle(), device, metricGroupHandle, &streamerDesc, eventHandle, &streamerHandle), ZE_RESULT_SUCCESS);
+    EXPECT_NE(streamerHandle, nullptr);
+
+    auto streamer = static_cast<IpSamplingMetricStreamerImp *>(MetricStreamer::fromHandle(streamerHandle));
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (streamer->getNotificationState() != Event::State::STATE_SIGNALED && std::chrono::steady_clock::now() < timeout) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(Event::State::STATE_SIGNALED, streamer->getNotificationState());
+
+    std::vector<uint8_t> rawData(unitReportSize);
+    size_t rawSize = rawData.size();
+    EXPECT_EQ(zetMetricStreamerReadData(streamerHandle, 1, &rawSize, rawData.data()), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(unitReportSize, rawSize);
+    for (auto data : rawData) {
+        EXPECT_EQ(5u, data);
+    }
+    EXPECT_EQ(zetMetricStreamerClose(streamerHandle), ZE_RESULT_SUCCESS);
+}
+
 } // namespace ult
 } // namespace L0
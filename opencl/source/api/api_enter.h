@@ -7,8 +7,10 @@
 
 #pragma once
 
+#include "shared/source/utilities/api_trace_recorder.h"
 #include "shared/source/utilities/logger.h"
 #include "shared/source/utilities/perf_profiler.h"
 
 #define API_ENTER(retValPointer) \
-    LoggerApiEnterWrapper<NEO::FileLogger<globalDebugFunctionalityLevel>::enabled()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer)
+    LoggerApiEnterWrapper<NEO::FileLogger<globalDebugFunctionalityLevel>::enabled()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer); \
+    NEO::ApiTraceScope apiTraceScopeForSingleCall(__FUNCTION__, retValPointer)
@@ -569,22 +569,29 @@ bool Context::BufferPoolAllocator::isAggregatedSmallBuffersEnabled(Context *cont
            (isSupportedForSingleDeviceContexts && context->isSingleDeviceContext());
 }
 
-Context::BufferPool::BufferPool(Context *context) : BaseType(context->memoryManager, nullptr) {
+bool Context::BufferPoolAllocator::isMediumBuffersTierEnabled() const {
+    return debugManager.flags.ExperimentalMediumBufferPoolAllocator.get() == 1;
+}
+
+Context::BufferPool::BufferPool(Context *context) : BufferPool(context, BufferPoolAllocator::aggregatedSmallBuffersPoolSize, BufferPoolAllocator::chunkAlignment) {}
+
+Context::BufferPool::BufferPool(Context *context, size_t poolSize, size_t poolChunkAlignment) : BaseType(context->memoryManager, nullptr) {
     static constexpr cl_mem_flags flags{};
     [[maybe_unused]] cl_int errcodeRet{};
     Buffer::AdditionalBufferCreateArgs bufferCreateArgs{};
     bufferCreateArgs.doNotProvidePerformanceHints = true;
     bufferCreateArgs.makeAllocationLockable = true;
+    bufferCreateArgs.doNotAllocateFromPool = true;
     this->mainStorage.reset(Buffer::create(context,
                                            flags,
-                                           BufferPoolAllocator::aggregatedSmallBuffersPoolSize,
+                                           poolSize,
                                            nullptr,
                                            bufferCreateArgs,
                                            errcodeRet));
     if (this->mainStorage) {
         this->chunkAllocator.reset(new HeapAllocator(BufferPool::startingOffset,
-                                                     BufferPoolAllocator::aggregatedSmallBuffersPoolSize,
-                                                     BufferPoolAllocator::chunkAlignment));
+                                                     poolSize,
+                                                     poolChunkAlignment));
         context->decRefInternal();
     }
 }
@@ -593,6 +600,10 @@ const StackVec<NEO::GraphicsAllocation *, 1> &Context::BufferPool::getAllocation
     return this->mainStorage->getMultiGraphicsAllocation().getGraphicsAllocations();
 }
 
+bool Context::BufferPool::isEmpty() const {
+    return this->chunkAllocator->getUsedSize() == 0u && this->chunksToFree.empty();
+}
+
 Buffer *Context::BufferPool::allocate(const MemoryProperties &memoryProperties,
                                       cl_mem_flags flags,
                                       cl_mem_flags_intel flagsIntel,
@@ -619,7 +630,26 @@ void Context::BufferPoolAllocator::initAggregatedSmallBuffers(Context *context)
     const auto bitfield = device.getDeviceBitfield();
     const auto deviceMemory = device.getGlobalMemorySize(static_cast<uint32_t>(bitfield.to_ulong()));
     this->maxPoolCount = this->calculateMaxPoolCount(deviceMemory, 2);
+    this->maxMediumPoolCount = this->calculateMaxPoolCount(deviceMemory, 2, mediumBuffersTierParams.poolSize);
     this->addNewBufferPool(Context::BufferPool{this->context});
+    if (!this->bufferPools.empty()) {
+        this->poolTierStatistics[static_cast<uint32_t>(PoolTier::small)].poolsCreated++;
+    }
+}
+
+bool Context::BufferPoolAllocator::isPoolBuffer(const MemObj *buffer) const {
+    return BaseType::isPoolBuffer(buffer, this->bufferPools) ||
+           BaseType::isPoolBuffer(buffer, this->mediumBufferPools);
+}
+
+void Context::BufferPoolAllocator::tryFreeFromPoolBuffer(MemObj *possiblePoolBuffer, size_t offset, size_t size) {
+    BaseType::tryFreeFromPoolBuffer(possiblePoolBuffer, offset, size, this->bufferPools);
+    BaseType::tryFreeFromPoolBuffer(possiblePoolBuffer, offset, size, this->mediumBufferPools);
+}
+
+void Context::BufferPoolAllocator::releasePools() {
+    this->bufferPools.clear();
+    this->mediumBufferPools.clear();
 }
 
 Buffer *Context::BufferPoolAllocator::allocateBufferFromPool(const MemoryProperties &memoryProperties,
@@ -630,38 +660,64 @@ Buffer *Context::BufferPoolAllocator::allocateBufferFromPool(const MemoryPropert
                                                              cl_int &errcodeRet) {
     errcodeRet = CL_MEM_OBJECT_ALLOCATION_FAILURE;
     if (this->bufferPools.empty() ||
-        !this->isSizeWithinThreshold(requestedSize) ||
         !flagsAllowBufferFromPool(flags, flagsIntel)) {
         return nullptr;
     }
 
-    auto lock = std::unique_lock<std::mutex>(mutex);
-    auto bufferFromPool = this->allocateFromPools(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
-    if (bufferFromPool != nullptr) {
-        return bufferFromPool;
+    if (this->isSizeWithinThreshold(requestedSize)) {
+        return this->allocateFromTier(PoolTier::small, memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
+    }
+    if (this->isMediumBuffersTierEnabled() && requestedSize <= mediumBuffersTierParams.threshold) {
+        return this->allocateFromTier(PoolTier::medium, memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
     }
+    return nullptr;
+}
 
-    this->drain();
+Buffer *Context::BufferPoolAllocator::allocateFromTier(PoolTier tier,
+                                                       const MemoryProperties &memoryProperties,
+                                                       cl_mem_flags flags,
+                                                       cl_mem_flags_intel flagsIntel,
+                                                       size_t requestedSize,
+                                                       void *hostPtr,
+                                                       cl_int &errcodeRet) {
+    auto &tierPools = this->getTierPools(tier);
+    auto &tierParams = this->getTierParams(tier);
+    auto &statistics = this->poolTierStatistics[static_cast<uint32_t>(tier)];
+    const auto tierMaxPoolCount = tier == PoolTier::small ? this->maxPoolCount : this->maxMediumPoolCount;
 
-    bufferFromPool = this->allocateFromPools(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
-    if (bufferFromPool != nullptr) {
-        return bufferFromPool;
+    auto lock = std::unique_lock<std::mutex>(mutex);
+    auto bufferFromPool = this->allocateFromPools(tierPools, memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
+    if (bufferFromPool == nullptr && !tierPools.empty()) {
+        this->drain(tierPools);
+        this->releaseEmptyPools(tier);
+        bufferFromPool = this->allocateFromPools(tierPools, memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
+    }
+
+    if (bufferFromPool == nullptr && tierPools.size() < tierMaxPoolCount) {
+        const auto poolCountBefore = tierPools.size();
+        this->addNewBufferPool(BufferPool{this->context, tierParams.poolSize, tierParams.chunkAlignment}, tierPools);
+        if (tierPools.size() > poolCountBefore) {
+            statistics.poolsCreated++;
+            bufferFromPool = this->allocateFromPools(tierPools, memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
+        }
     }
 
-    if (this->bufferPools.size() < this->maxPoolCount) {
-        this->addNewBufferPool(BufferPool{this->context});
-        return this->allocateFromPools(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
+    if (bufferFromPool != nullptr) {
+        statistics.buffersAllocated++;
+    } else {
+        statistics.allocationFailures++;
     }
-    return nullptr;
+    return bufferFromPool;
 }
 
-Buffer *Context::BufferPoolAllocator::allocateFromPools(const MemoryProperties &memoryProperties,
+Buffer *Context::BufferPoolAllocator::allocateFromPools(std::vector<BufferPool> &bufferPoolsVec,
+                                                        const MemoryProperties &memoryProperties,
                                                         cl_mem_flags flags,
                                                         cl_mem_flags_intel flagsIntel,
                                                         size_t requestedSize,
                                                         void *hostPtr,
                                                         cl_int &errcodeRet) {
-    for (auto &bufferPoolParent : this->bufferPools) {
+    for (auto &bufferPoolParent : bufferPoolsVec) {
         auto &bufferPool = static_cast<BufferPool &>(bufferPoolParent);
         auto bufferFromPool = bufferPool.allocate(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
         if (bufferFromPool != nullptr) {
@@ -672,6 +728,27 @@ Buffer *Context::BufferPoolAllocator::allocateFromPools(const MemoryProperties &
     return nullptr;
 }
 
+void Context::BufferPoolAllocator::releaseEmptyPools(PoolTier tier) {
+    auto &tierPools = this->getTierPools(tier);
+    std::vector<BufferPool> remainingPools;
+    remainingPools.reserve(tierPools.size());
+    bool emptyPoolKept = false;
+    for (auto &bufferPool : tierPools) {
+        if (bufferPool.isEmpty()) {
+            if (emptyPoolKept) {
+                // storage is no longer recognized as pool buffer while being destroyed, so it releases context reference like regular buffer
+                this->context->incRefInternal();
+                bufferPool.mainStorage.reset();
+                this->poolTierStatistics[static_cast<uint32_t>(tier)].poolsReleased++;
+                continue;
+            }
+            emptyPoolKept = true;
+        }
+        remainingPools.push_back(std::move(bufferPool));
+    }
+    tierPools.swap(remainingPools);
+}
+
 TagAllocatorBase *Context::getMultiRootDeviceTimestampPacketAllocator() {
     return multiRootDeviceTimestampPacketAllocator.get();
 }
@@ -22,6 +22,7 @@
 #include "opencl/source/helpers/destructor_callbacks.h"
 #include "opencl/source/mem_obj/map_operations_handler.h"
 
+#include <array>
 #include <map>
 
 enum class InternalMemoryType : uint32_t;
@@ -58,6 +59,7 @@ class Context : public BaseObject<_cl_context> {
         using BaseType = AbstractBuffersPool<BufferPool, Buffer, MemObj>;
 
         BufferPool(Context *context);
+        BufferPool(Context *context, size_t poolSize, size_t poolChunkAlignment);
         Buffer *allocate(const MemoryProperties &memoryProperties,
                          cl_mem_flags flags,
                          cl_mem_flags_intel flagsIntel,
@@ -66,11 +68,40 @@ class Context : public BaseObject<_cl_context> {
                          cl_int &errcodeRet);
 
         const StackVec<NEO::GraphicsAllocation *, 1> &getAllocationsVector();
+        bool isEmpty() const;
     };
 
     class BufferPoolAllocator : public AbstractBuffersAllocator<BufferPool, Buffer, MemObj> {
+        using BaseType = AbstractBuffersAllocator<BufferPool, Buffer, MemObj>;
+
       public:
+        enum class PoolTier : uint32_t {
+            small = 0,
+            medium,
+            count
+        };
+
+        struct PoolTierParams {
+            size_t threshold;
+            size_t poolSize;
+            size_t chunkAlignment;
+        };
+
+        struct PoolTierStatistics {
+            uint64_t buffersAllocated = 0u;
+            uint64_t allocationFailures = 0u;
+            uint32_t poolsCreated = 0u;
+            uint32_t poolsReleased = 0u;
+        };
+
+        static constexpr PoolTierParams smallBuffersTierParams = {BaseType::smallBufferThreshold, BaseType::aggregatedSmallBuffersPoolSize, BaseType::chunkAlignment};
+        static constexpr PoolTierParams mediumBuffersTierParams = {4 * MemoryConstants::megaByte, 16 * MemoryConstants::megaByte, MemoryConstants::pageSize64k};
+        static_assert(mediumBuffersTierParams.threshold > smallBuffersTierParams.threshold, "Tiers need to be ordered by threshold");
+        static_assert(mediumBuffersTierParams.poolSize > mediumBuffersTierParams.threshold, "Largest allowed buffer needs to fit in pool");
+        static_assert(BaseType::startingOffset % mediumBuffersTierParams.chunkAlignment == 0, "Chunk alignment needs to be preserved relative to pool start");
+
         bool isAggregatedSmallBuffersEnabled(Context *context) const;
+        bool isMediumBuffersTierEnabled() const;
         void initAggregatedSmallBuffers(Context *context);
         Buffer *allocateBufferFromPool(const MemoryProperties &memoryProperties,
                                        cl_mem_flags flags,
@@ -79,21 +110,48 @@ class Context : public BaseObject<_cl_context> {
                                        void *hostPtr,
                                        cl_int &errcodeRet);
         bool flagsAllowBufferFromPool(const cl_mem_flags &flags, const cl_mem_flags_intel &flagsIntel) const;
+        bool isPoolBuffer(const MemObj *buffer) const;
+        void tryFreeFromPoolBuffer(MemObj *possiblePoolBuffer, size_t offset, size_t size);
+        void releasePools();
+        const PoolTierStatistics &getPoolTierStatistics(PoolTier tier) const {
+            return this->poolTierStatistics[static_cast<uint32_t>(tier)];
+        }
 
       protected:
-        Buffer *allocateFromPools(const MemoryProperties &memoryProperties,
+        Buffer *allocateFromTier(PoolTier tier,
+                                 const MemoryProperties &memoryProperties,
+                                 cl_mem_flags flags,
+                                 cl_mem_flags_intel flagsIntel,
+                                 size_t requestedSize,
+                                 void *hostPtr,
+                                 cl_int &errcodeRet);
+        Buffer *allocateFromPools(std::vector<BufferPool> &bufferPoolsVec,
+                                  const MemoryProperties &memoryProperties,
                                   cl_mem_flags flags,
                                   cl_mem_flags_intel flagsIntel,
                                   size_t requestedSize,
                                   void *hostPtr,
                                   cl_int &errcodeRet);
+        void releaseEmptyPools(PoolTier tier);
+        std::vector<BufferPool> &getTierPools(PoolTier tier) {
+            return tier == PoolTier::small ? this->bufferPools : this->mediumBufferPools;
+        }
+        static const PoolTierParams &getTierParams(PoolTier tier) {
+            return tier == PoolTier::small ? smallBuffersTierParams : mediumBuffersTierParams;
+        }
         static inline size_t calculateMaxPoolCount(uint64_t totalMemory, size_t percentOfMemory) {
-            const auto maxPoolCount = static_cast<size_t>(totalMemory * (percentOfMemory / 100.0) / BufferPoolAllocator::aggregatedSmallBuffersPoolSize);
+            return calculateMaxPoolCount(totalMemory, percentOfMemory, BufferPoolAllocator::aggregatedSmallBuffersPoolSize);
+        }
+        static inline size_t calculateMaxPoolCount(uint64_t totalMemory, size_t percentOfMemory, size_t poolSize) {
+            const auto maxPoolCount = static_cast<size_t>(totalMemory * (percentOfMemory / 100.0) / poolSize);
             return maxPoolCount ? maxPoolCount : 1u;
         }
 
         Context *context{nullptr};
         size_t maxPoolCount{1u};
+        size_t maxMediumPoolCount{1u};
+        std::vector<BufferPool> mediumBufferPools;
+        std::array<PoolTierStatistics, static_cast<uint32_t>(PoolTier::count)> poolTierStatistics{};
     };
 
     static const cl_ulong objectMagic = 0xA4234321DC002130LL;
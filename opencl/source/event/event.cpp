@@ -35,8 +35,32 @@
 
 #include <algorithm>
 #include <iostream>
+#include <vector>
 
 namespace NEO {
+namespace {
+struct PendingUnblock {
+    enum class Step {
+        unblockChild,
+        releaseChild,
+        updateExecutionStatus,
+        executeCallbacks
+    };
+    Step step;
+    Event *event;
+    Event *blockingEvent;
+    TaskCountType taskLevel;
+    int32_t status;
+    bool releaseBlockingEvent;
+};
+
+// Unblocking propagates through the whole dependency graph of blocked commands. Children are collected on a
+// per-thread stack drained by the outermost unblocking call, so deep graphs do not recurse. Work that followed
+// unblocking of children in recursive propagation is pushed below these children, so commands are submitted
+// and callbacks are executed in the same depth-first order as they were with recursive propagation.
+thread_local std::vector<PendingUnblock> *pendingUnblocks = nullptr;
+} // namespace
+
 Event::Event(
     Context *ctx,
     CommandQueue *cmdQueue,
@@ -595,16 +619,59 @@ void Event::unblockEventsBlockedByThis(int32_t transitionStatus) {
     }
 
     auto childEventRef = childEventsToNotify.detachNodes();
-    while (childEventRef != nullptr) {
-        auto childEvent = childEventRef->ref;
+    if (childEventRef == nullptr) {
+        return;
+    }
+
+    // Event being destroyed can not be referenced later, so its children are unblocked right away.
+    const bool drainHere = (pendingUnblocks == nullptr) || (this->getRefInternalCount() == 0);
+    std::vector<PendingUnblock> worklist;
+    auto outerPendingUnblocks = pendingUnblocks;
+    if (drainHere) {
+        pendingUnblocks = &worklist;
+    }
 
-        childEvent->unblockEventBy(*this, taskLevelToPropagate, transitionStatus);
+    const auto firstChildPosition = pendingUnblocks->size();
+    while (childEventRef != nullptr) {
+        if (drainHere == false) {
+            this->incRefInternal();
+        }
+        pendingUnblocks->push_back({PendingUnblock::Step::unblockChild, childEventRef->ref, this, taskLevelToPropagate, transitionStatus, drainHere == false});
 
-        childEvent->decRefInternal();
         auto next = childEventRef->next;
         delete childEventRef;
         childEventRef = next;
     }
+    std::reverse(pendingUnblocks->begin() + firstChildPosition, pendingUnblocks->end());
+
+    if (drainHere) {
+        while (worklist.empty() == false) {
+            auto pendingUnblock = worklist.back();
+            worklist.pop_back();
+
+            switch (pendingUnblock.step) {
+            case PendingUnblock::Step::unblockChild:
+                pendingUnblock.step = PendingUnblock::Step::releaseChild;
+                worklist.push_back(pendingUnblock);
+                pendingUnblock.event->unblockEventBy(*pendingUnblock.blockingEvent, pendingUnblock.taskLevel, pendingUnblock.status);
+                break;
+            case PendingUnblock::Step::releaseChild:
+                pendingUnblock.event->decRefInternal();
+                if (pendingUnblock.releaseBlockingEvent) {
+                    pendingUnblock.blockingEvent->decRefInternal();
+                }
+                break;
+            case PendingUnblock::Step::updateExecutionStatus:
+                pendingUnblock.event->updateExecutionStatus();
+                break;
+            case PendingUnblock::Step::executeCallbacks:
+                pendingUnblock.event->executeCallbacks(pendingUnblock.status);
+                pendingUnblock.event->decRefInternal();
+                break;
+            }
+        }
+        pendingUnblocks = outerPendingUnblocks;
+    }
 }
 
 bool Event::setStatus(cl_int status) {
@@ -631,11 +698,18 @@ bool Event::setStatus(cl_int status) {
 
     this->incRefInternal();
     transitionExecutionStatus(status);
+    // callbacks are executed once events blocked by this one are submitted
+    const bool deferCallbacks = (pendingUnblocks != nullptr);
+    if (deferCallbacks) {
+        pendingUnblocks->push_back({PendingUnblock::Step::executeCallbacks, this, nullptr, CompletionStamp::notReady, status, false});
+    }
     if (isStatusCompleted(status) || (status == CL_SUBMITTED)) {
         unblockEventsBlockedByThis(status);
     }
-    executeCallbacks(status);
-    this->decRefInternal();
+    if (deferCallbacks == false) {
+        executeCallbacks(status);
+        this->decRefInternal();
+    }
     return true;
 }
 
@@ -850,7 +924,7 @@ TaskCountType Event::getTaskLevel() {
     return taskLevel;
 }
 
-inline void Event::unblockEventBy(Event &event, TaskCountType taskLevel, int32_t transitionStatus) {
+void Event::unblockEventBy(Event &event, TaskCountType taskLevel, int32_t transitionStatus) {
     int32_t numEventsBlockingThis = --parentCount;
     DEBUG_BREAK_IF(numEventsBlockingThis < 0);
 
@@ -872,10 +946,16 @@ inline void Event::unblockEventBy(Event &event, TaskCountType taskLevel, int32_t
     if (isStatusCompletedByTermination(blockerStatus)) {
         statusToPropagate = blockerStatus;
     }
+    // event may be completed after this operation, transtition the state to not block others.
+    const bool deferStatusUpdate = (pendingUnblocks != nullptr);
+    if (deferStatusUpdate) {
+        pendingUnblocks->push_back({PendingUnblock::Step::updateExecutionStatus, this, nullptr, CompletionStamp::notReady, CL_SUBMITTED, false});
+    }
     setStatus(statusToPropagate);
 
-    // event may be completed after this operation, transtition the state to not block others.
-    this->updateExecutionStatus();
+    if (deferStatusUpdate == false) {
+        this->updateExecutionStatus();
+    }
 }
 
 bool Event::updateStatusAndCheckCompletion() {
@@ -909,8 +909,11 @@ cl_int Kernel::setArg(uint32_t argIndex, size_t argSize, const void *argVal) {
         if (argIndex >= kernelArgHandlers.size()) {
             return CL_INVALID_ARG_INDEX;
         }
-        argWasUncacheable = kernelArguments[argIndex].isStatelessUncacheable;
         auto argHandler = kernelArgHandlers[argIndex];
+        if (argHandler == &Kernel::setArgImmediate && isImmediateArgUnchanged(argIndex, argSize, argVal)) {
+            return CL_SUCCESS;
+        }
+        argWasUncacheable = kernelArguments[argIndex].isStatelessUncacheable;
         retVal = (this->*argHandler)(argIndex, argSize, argVal);
     }
     if (retVal == CL_SUCCESS) {
@@ -1778,6 +1781,24 @@ cl_int Kernel::setArgImmediate(uint32_t argIndex,
     return retVal;
 }
 
+bool Kernel::isImmediateArgUnchanged(uint32_t argIndex, size_t argSize, const void *argVal) const {
+    const auto &kernelArg = kernelArguments[argIndex];
+    if (argVal == nullptr || kernelArg.isPatched == false || kernelArg.type != NONE_OBJ || kernelArg.size != argSize) {
+        return false;
+    }
+
+    const auto &argAsVal = kernelInfo.kernelDescriptor.payloadMappings.explicitArgs[argIndex].as<ArgDescValue>();
+    for (const auto &element : argAsVal.elements) {
+        if (element.sourceOffset < argSize) {
+            size_t bytesToCompare = std::min(static_cast<size_t>(element.size), argSize - element.sourceOffset);
+            if (memcmp(ptrOffset(crossThreadData, element.offset), ptrOffset(argVal, element.sourceOffset), bytesToCompare) != 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 cl_int Kernel::setArgSampler(uint32_t argIndex,
                              size_t argSize,
                              const void *argVal) {
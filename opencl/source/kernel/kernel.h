@@ -454,6 +454,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
 
     void markArgPatchedAndResolveArgs(uint32_t argIndex);
     void resolveArgs();
+    bool isImmediateArgUnchanged(uint32_t argIndex, size_t argSize, const void *argVal) const;
 
     void reconfigureKernel();
     bool hasDirectStatelessAccessToSharedBuffer() const;
@@ -289,7 +289,8 @@ Buffer *Buffer::create(Context *context,
     const bool implicitScalingEnabled = ImplicitScalingHelper::isImplicitScalingEnabled(defaultDevice->getDeviceBitfield(), true);
     const bool useHostPtr = memoryProperties.flags.useHostPtr;
     const bool copyHostPtr = memoryProperties.flags.copyHostPtr;
-    if (implicitScalingEnabled == false &&
+    if (bufferCreateArgs.doNotAllocateFromPool == false &&
+        implicitScalingEnabled == false &&
         useHostPtr == false &&
         memoryProperties.flags.forceHostMemory == false &&
         memoryProperties.associatedDevices.empty()) {
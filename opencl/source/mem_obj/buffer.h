@@ -58,6 +58,7 @@ class Buffer : public MemObj {
     struct AdditionalBufferCreateArgs {
         bool doNotProvidePerformanceHints;
         bool makeAllocationLockable;
+        bool doNotAllocateFromPool;
     };
     constexpr static size_t maxBufferSizeForReadWriteOnCpu = 10 * MemoryConstants::megaByte;
     constexpr static size_t maxBufferSizeForCopyOnCpu = 64 * MemoryConstants::kiloByte;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,7 +26,10 @@ bool MapOperationsHandler::add(void *ptr, size_t ptrLength, cl_map_flags &mapFla
         return false;
     }
 
-    mappedPointers.push_back(mapInfo);
+    mappedPointers.insert(mapInfo.ptr, mapInfo.ptrLength, mapInfo);
+    if (storage) {
+        storage->addMappedPtr(memObj, mapInfo);
+    }
     return true;
 }
 
@@ -34,29 +37,22 @@ bool MapOperationsHandler::isOverlapping(MapInfo &inputMapInfo) {
     if (inputMapInfo.readOnly) {
         return false;
     }
-    auto inputStartPtr = inputMapInfo.ptr;
-    auto inputEndPtr = ptrOffset(inputStartPtr, inputMapInfo.ptrLength);
-
-    for (auto &mapInfo : mappedPointers) {
-        auto mappedStartPtr = mapInfo.ptr;
-        auto mappedEndPtr = ptrOffset(mappedStartPtr, mapInfo.ptrLength);
-
-        // Requested ptr starts before or inside existing ptr range and overlapping end
-        if (inputStartPtr < mappedEndPtr && inputEndPtr >= mappedStartPtr) {
-            return true;
-        }
-    }
-    return false;
+    auto inputStartPtr = reinterpret_cast<uintptr_t>(inputMapInfo.ptr);
+    auto inputEndPtr = reinterpret_cast<uintptr_t>(ptrOffset(inputMapInfo.ptr, inputMapInfo.ptrLength));
+
+    // Requested ptr starts before or inside existing ptr range and overlapping end
+    auto overlappingMapping = mappedPointers.findIntersecting(inputStartPtr, inputEndPtr, [inputStartPtr](const auto &mapping) {
+        return inputStartPtr < mapping.end;
+    });
+    return overlappingMapping != nullptr;
 }
 
 bool MapOperationsHandler::find(void *mappedPtr, MapInfo &outMapInfo) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    for (auto &mapInfo : mappedPointers) {
-        if (mapInfo.ptr == mappedPtr) {
-            outMapInfo = mapInfo;
-            return true;
-        }
+    if (auto mapInfo = mappedPointers.find(mappedPtr)) {
+        outMapInfo = *mapInfo;
+        return true;
     }
     return false;
 }
@@ -64,14 +60,11 @@ bool MapOperationsHandler::find(void *mappedPtr, MapInfo &outMapInfo) {
 bool NEO::MapOperationsHandler::findInfoForHostPtr(const void *ptr, size_t size, MapInfo &outMapInfo) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    for (auto &mapInfo : mappedPointers) {
-        void *ptrStart = mapInfo.ptr;
-        void *ptrEnd = ptrOffset(mapInfo.ptr, mapInfo.ptrLength);
-
-        if (ptrStart <= ptr && ptrOffset(ptr, size) <= ptrEnd) {
-            outMapInfo = mapInfo;
-            return true;
-        }
+    auto ptrStart = reinterpret_cast<uintptr_t>(ptr);
+    auto ptrEnd = reinterpret_cast<uintptr_t>(ptrOffset(ptr, size));
+    if (auto mapping = mappedPointers.findIntersecting(ptrEnd, ptrStart, [](const auto &) { return true; })) {
+        outMapInfo = mapping->value;
+        return true;
     }
     return false;
 }
@@ -79,19 +72,14 @@ bool NEO::MapOperationsHandler::findInfoForHostPtr(const void *ptr, size_t size,
 void MapOperationsHandler::remove(void *mappedPtr) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    auto endIter = mappedPointers.end();
-    for (auto it = mappedPointers.begin(); it != endIter; it++) {
-        if (it->ptr == mappedPtr) {
-            std::iter_swap(it, mappedPointers.end() - 1);
-            mappedPointers.pop_back();
-            break;
-        }
+    if (mappedPointers.remove(mappedPtr) && storage) {
+        storage->removeMappedPtr(memObj, mappedPtr);
     }
 }
 
 MapOperationsHandler &NEO::MapOperationsStorage::getHandler(cl_mem memObj) {
     std::lock_guard<std::mutex> lock(mutex);
-    return handlers[memObj];
+    return handlers.try_emplace(memObj, this, memObj).first->second;
 }
 
 MapOperationsHandler *NEO::MapOperationsStorage::getHandlerIfExists(cl_mem memObj) {
@@ -106,10 +94,12 @@ MapOperationsHandler *NEO::MapOperationsStorage::getHandlerIfExists(cl_mem memOb
 
 bool NEO::MapOperationsStorage::getInfoForHostPtr(const void *ptr, size_t size, MapInfo &outInfo) {
     std::lock_guard<std::mutex> lock(mutex);
-    for (auto &entry : handlers) {
-        if (entry.second.findInfoForHostPtr(ptr, size, outInfo)) {
-            return true;
-        }
+
+    auto ptrStart = reinterpret_cast<uintptr_t>(ptr);
+    auto ptrEnd = reinterpret_cast<uintptr_t>(ptrOffset(ptr, size));
+    if (auto mapping = mappedPointers.findIntersecting(ptrEnd, ptrStart, [](const auto &) { return true; })) {
+        outInfo = mapping->value.second;
+        return true;
     }
     return false;
 }
@@ -118,4 +108,15 @@ void NEO::MapOperationsStorage::removeHandler(cl_mem memObj) {
     std::lock_guard<std::mutex> lock(mutex);
     auto iterator = handlers.find(memObj);
     handlers.erase(iterator);
+    mappedPointers.removeAll([memObj](const auto &mapping) { return mapping.first == memObj; });
+}
+
+void NEO::MapOperationsStorage::addMappedPtr(cl_mem memObj, const MapInfo &mapInfo) {
+    std::lock_guard<std::mutex> lock(mutex);
+    mappedPointers.insert(mapInfo.ptr, mapInfo.ptrLength, {memObj, mapInfo});
+}
+
+void NEO::MapOperationsStorage::removeMappedPtr(cl_mem memObj, void *mappedPtr) {
+    std::lock_guard<std::mutex> lock(mutex);
+    mappedPointers.remove(mappedPtr, [memObj](const auto &mapping) { return mapping.first == memObj; });
 }
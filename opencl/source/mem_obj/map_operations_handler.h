@@ -1,21 +1,26 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/utilities/interval_tree.h"
+
 #include "opencl/source/helpers/properties_helper.h"
 
 #include <mutex>
 #include <unordered_map>
-#include <vector>
+#include <utility>
 
 namespace NEO {
+class MapOperationsStorage;
 
 class MapOperationsHandler {
   public:
+    MapOperationsHandler() = default;
+    MapOperationsHandler(MapOperationsStorage *storage, cl_mem memObj) : storage(storage), memObj(memObj) {}
     virtual ~MapOperationsHandler() = default;
 
     bool add(void *ptr, size_t ptrLength, cl_map_flags &mapFlags, MemObjSizeArray &size, MemObjOffsetArray &offset, uint32_t mipLevel, GraphicsAllocation *graphicsAllocation);
@@ -26,7 +31,9 @@ class MapOperationsHandler {
 
   protected:
     bool isOverlapping(MapInfo &inputMapInfo);
-    std::vector<MapInfo> mappedPointers;
+    IntervalTree<MapInfo> mappedPointers;
+    MapOperationsStorage *storage = nullptr;
+    cl_mem memObj = nullptr;
     mutable std::mutex mtx;
 };
 
@@ -39,9 +46,13 @@ class MapOperationsStorage {
     bool getInfoForHostPtr(const void *ptr, size_t size, MapInfo &outInfo);
     void removeHandler(cl_mem memObj);
 
+    void addMappedPtr(cl_mem memObj, const MapInfo &mapInfo);
+    void removeMappedPtr(cl_mem memObj, void *mappedPtr);
+
   protected:
     std::mutex mutex;
     HandlersMap handlers{};
+    IntervalTree<std::pair<cl_mem, MapInfo>> mappedPointers;
 };
 
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1109,3 +1109,84 @@ TEST_F(EventTests, givenUserEventWhenSetStatusIsDoneThenDeviceMutextisAcquired)
     clSetUserEventStatus(&mockEvent, CL_COMPLETE);
     EXPECT_TRUE(mockEvent.mutexProperlyAcquired);
 }
+
+struct UnblockOrderTrackingEvent : public Event {
+    UnblockOrderTrackingEvent(CommandQueue *cmdQueue, std::vector<Event *> &unblockOrder) : Event(cmdQueue, CL_COMMAND_NDRANGE_KERNEL, 0, 0), unblockOrder(unblockOrder) {}
+
+    void unblockEventBy(Event &event, TaskCountType taskLevel, int32_t transitionStatus) override {
+        unblockOrder.push_back(this);
+        Event::unblockEventBy(event, taskLevel, transitionStatus);
+    }
+
+    std::vector<Event *> &unblockOrder;
+};
+
+TEST_F(EventTests, givenDeepChainOfEventsBlockedByUserEventWhenUserEventIsCompletedThenAllEventsAreUnblockedInChainOrder) {
+    constexpr size_t chainLength = 10000;
+    std::vector<Event *> unblockOrder;
+    std::vector<std::unique_ptr<UnblockOrderTrackingEvent>> events;
+    UserEvent uEvent;
+
+    Event *parent = &uEvent;
+    for (size_t i = 0; i < chainLength; i++) {
+        events.push_back(std::make_unique<UnblockOrderTrackingEvent>(pCmdQ, unblockOrder));
+        parent->addChild(*events.back());
+        parent = events.back().get();
+    }
+
+    uEvent.setStatus(CL_COMPLETE);
+
+    ASSERT_EQ(chainLength, unblockOrder.size());
+    for (size_t i = 0; i < chainLength; i++) {
+        EXPECT_EQ(events[i].get(), unblockOrder[i]);
+        EXPECT_EQ(CL_COMPLETE, events[i]->peekExecutionStatus());
+    }
+}
+
+TEST_F(EventTests, givenEventGraphBlockedByUserEventWhenUserEventIsCompletedThenEventsAreUnblockedDepthFirst) {
+    std::vector<Event *> unblockOrder;
+    UserEvent uEvent;
+    UnblockOrderTrackingEvent eventA(pCmdQ, unblockOrder);
+    UnblockOrderTrackingEvent eventB(pCmdQ, unblockOrder);
+    UnblockOrderTrackingEvent eventC(pCmdQ, unblockOrder);
+    UnblockOrderTrackingEvent eventD(pCmdQ, unblockOrder);
+
+    uEvent.addChild(eventA);
+    uEvent.addChild(eventB);
+    eventA.addChild(eventC);
+    eventB.addChild(eventD);
+
+    uEvent.setStatus(CL_COMPLETE);
+
+    std::vector<Event *> expectedOrder = {&eventB, &eventD, &eventA, &eventC};
+    EXPECT_EQ(expectedOrder, unblockOrder);
+}
+
+TEST_F(EventTests, givenEventChainBlockedByUserEventWhenUserEventIsCompletedThenCallbacksOfEventAreExecutedAfterEventsBlockedByItAreSubmitted) {
+    DebugManagerStateRestore dbgRestore;
+    debugManager.flags.EnableAsyncEventsHandler.set(false);
+    struct ChildStatusClb {
+        static void CL_CALLBACK storeChildStatus(cl_event e, cl_int status, void *data) {
+            auto childEventData = static_cast<std::pair<Event *, int32_t> *>(data);
+            childEventData->second = childEventData->first->peekExecutionStatus();
+        }
+    };
+
+    std::vector<Event *> unblockOrder;
+    UserEvent uEvent;
+    UnblockOrderTrackingEvent eventA(pCmdQ, unblockOrder);
+    UnblockOrderTrackingEvent eventB(pCmdQ, unblockOrder);
+
+    uEvent.addChild(eventA);
+    eventA.addChild(eventB);
+
+    std::pair<Event *, int32_t> childEventData{&eventB, CL_QUEUED};
+    eventA.addCallback(ChildStatusClb::storeChildStatus, CL_SUBMITTED, &childEventData);
+    EXPECT_EQ(CL_QUEUED, eventB.peekExecutionStatus());
+
+    uEvent.setStatus(CL_COMPLETE);
+
+    std::vector<Event *> expectedOrder = {&eventA, &eventB};
+    EXPECT_EQ(expectedOrder, unblockOrder);
+    EXPECT_TRUE(childEventData.second == CL_SUBMITTED || childEventData.second == CL_COMPLETE);
+}
@@ -365,3 +365,52 @@ TYPED_TEST(KernelArgImmediateTest, givenMultiplePatchesAndOneSourceOffsetBeyondA
         EXPECT_EQ(CL_SUCCESS, retVal);
     }
 }
+
+TYPED_TEST(KernelArgImmediateTest, givenArgAlreadySetWhenSettingSameValueAgainThenArgStaysPatchedWithSameValue) {
+    auto val = (TypeParam)0xaaaaaaaaULL;
+    EXPECT_EQ(CL_SUCCESS, this->pMultiDeviceKernel->setArg(0, sizeof(TypeParam), &val));
+    EXPECT_EQ(CL_SUCCESS, this->pMultiDeviceKernel->setArg(0, sizeof(TypeParam), &val));
+
+    for (auto &rootDeviceIndex : this->context->getRootDeviceIndices()) {
+        auto pKernel = this->pMultiDeviceKernel->getKernel(rootDeviceIndex);
+        auto pKernelArg = (TypeParam *)(pKernel->getCrossThreadData() +
+                                        this->pKernelInfo->argAsVal(0).elements[0].offset);
+
+        EXPECT_EQ(val, *pKernelArg);
+        EXPECT_TRUE(pKernel->getKernelArgInfo(0).isPatched);
+        EXPECT_EQ(sizeof(TypeParam), pKernel->getKernelArgInfo(0).size);
+    }
+}
+
+TYPED_TEST(KernelArgImmediateTest, givenArgWithMultipleElementsWhenOnlyOneElementDiffersFromNewValueThenAllElementsArePatched) {
+    auto val = (TypeParam)0xaaaaaaaaULL;
+    EXPECT_EQ(CL_SUCCESS, this->pMultiDeviceKernel->setArg(3, sizeof(TypeParam), &val));
+
+    for (auto &rootDeviceIndex : this->context->getRootDeviceIndices()) {
+        auto pKernel = this->pMultiDeviceKernel->getKernel(rootDeviceIndex);
+        memset(pKernel->getCrossThreadData() + this->pKernelInfo->argAsVal(3).elements[2].offset, 0, sizeof(TypeParam));
+    }
+
+    EXPECT_EQ(CL_SUCCESS, this->pMultiDeviceKernel->setArg(3, sizeof(TypeParam), &val));
+
+    for (auto &rootDeviceIndex : this->context->getRootDeviceIndices()) {
+        auto pKernel = this->pMultiDeviceKernel->getKernel(rootDeviceIndex);
+        for (const auto &element : this->pKernelInfo->argAsVal(3).elements) {
+            auto pKernelArg = (TypeParam *)(pKernel->getCrossThreadData() + element.offset);
+            EXPECT_EQ(val, *pKernelArg);
+        }
+    }
+}
+
+TYPED_TEST(KernelArgImmediateTest, givenUnsetArgWithMatchingCrossThreadDataWhenSettingArgThenArgIsMarkedAsPatched) {
+    auto val = (TypeParam)0xaaaaaaaaULL;
+    EXPECT_EQ(CL_SUCCESS, this->pMultiDeviceKernel->setArg(0, sizeof(TypeParam), &val));
+    this->pMultiDeviceKernel->unsetArg(0);
+
+    EXPECT_EQ(CL_SUCCESS, this->pMultiDeviceKernel->setArg(0, sizeof(TypeParam), &val));
+
+    for (auto &rootDeviceIndex : this->context->getRootDeviceIndices()) {
+        auto pKernel = this->pMultiDeviceKernel->getKernel(rootDeviceIndex);
+        EXPECT_TRUE(pKernel->getKernelArgInfo(0).isPatched);
+    }
+}
@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/utilities/buffer_pool_allocator.inl"
 #include "shared/source/utilities/heap_allocator.h"
@@ -480,6 +481,129 @@ TEST_F(AggregatedSmallBuffersKernelTest, givenBufferFromPoolWhenOffsetSubbufferI
     EXPECT_EQ(reinterpret_cast<void *>(gpuAddress + region.origin + buffer->getOffset()), *pKernelArg);
 }
 
+class AggregatedMediumBuffersEnabledTest : public AggregatedSmallBuffersTestTemplate<1> {
+  public:
+    void SetUp() override {
+        AggregatedSmallBuffersTestTemplate::SetUp();
+        debugManager.flags.ExperimentalMediumBufferPoolAllocator.set(1);
+        this->size = PoolAllocator::smallBufferThreshold + 1;
+    }
+    static constexpr auto mediumTierParams = PoolAllocator::mediumBuffersTierParams;
+};
+
+TEST_F(AggregatedSmallBuffersEnabledTest, givenMediumBuffersTierNotEnabledWhenMediumBufferCreateCalledThenDoNotUsePool) {
+    EXPECT_FALSE(poolAllocator->isMediumBuffersTierEnabled());
+    size = PoolAllocator::smallBufferThreshold + 1;
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_NE(nullptr, buffer);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_FALSE(static_cast<MockBuffer *>(buffer.get())->isSubBuffer());
+    EXPECT_TRUE(poolAllocator->mediumBufferPools.empty());
+}
+
+TEST_F(AggregatedMediumBuffersEnabledTest, givenMediumBuffersTierEnabledWhenContextCreatedThenMediumPoolIsNotCreatedUntilRequested) {
+    EXPECT_TRUE(poolAllocator->isMediumBuffersTierEnabled());
+    EXPECT_EQ(1u, poolAllocator->bufferPools.size());
+    EXPECT_TRUE(poolAllocator->mediumBufferPools.empty());
+    EXPECT_EQ(0u, poolAllocator->getPoolTierStatistics(PoolAllocator::PoolTier::medium).poolsCreated);
+}
+
+TEST_F(AggregatedMediumBuffersEnabledTest, givenMediumBuffersTierEnabledWhenBufferAboveSmallThresholdCreatedThenMediumPoolIsUsed) {
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_NE(nullptr, buffer);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    ASSERT_EQ(1u, poolAllocator->mediumBufferPools.size());
+    auto mockBuffer = static_cast<MockBuffer *>(buffer.get());
+    EXPECT_TRUE(mockBuffer->isSubBuffer());
+    EXPECT_EQ(mockBuffer->associatedMemObject, poolAllocator->mediumBufferPools[0].mainStorage.get());
+    EXPECT_TRUE(poolAllocator->isPoolBuffer(poolAllocator->mediumBufferPools[0].mainStorage.get()));
+    EXPECT_EQ(0u, mockBuffer->getOffset() % mediumTierParams.chunkAlignment);
+    EXPECT_EQ(alignUp(size, mediumTierParams.chunkAlignment), poolAllocator->mediumBufferPools[0].chunkAllocator->getUsedSize());
+    EXPECT_EQ(0u, poolAllocator->bufferPools[0].chunkAllocator->getUsedSize());
+
+    const auto &statistics = poolAllocator->getPoolTierStatistics(PoolAllocator::PoolTier::medium);
+    EXPECT_EQ(1u, statistics.poolsCreated);
+    EXPECT_EQ(1u, statistics.buffersAllocated);
+    EXPECT_EQ(0u, statistics.allocationFailures);
+}
+
+TEST_F(AggregatedMediumBuffersEnabledTest, givenMediumBuffersTierEnabledWhenBufferAboveMediumThresholdCreatedThenDoNotUsePool) {
+    size = mediumTierParams.threshold + 1;
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_NE(nullptr, buffer);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_FALSE(static_cast<MockBuffer *>(buffer.get())->isSubBuffer());
+    EXPECT_TRUE(poolAllocator->mediumBufferPools.empty());
+}
+
+TEST_F(AggregatedMediumBuffersEnabledTest, givenMediumPoolLimitReachedWhenMediumPoolIsExhaustedThenAllocationFailureIsCounted) {
+    poolAllocator->maxMediumPoolCount = 1u;
+    size = mediumTierParams.threshold;
+    constexpr auto buffersToCreate = mediumTierParams.poolSize / mediumTierParams.threshold;
+    mockMemoryManager->deferAllocInUse = true;
+    std::vector<std::unique_ptr<Buffer>> buffers(buffersToCreate + 1);
+    for (auto i = 0u; i < buffersToCreate + 1; i++) {
+        buffers[i].reset(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+        EXPECT_EQ(retVal, CL_SUCCESS);
+    }
+    EXPECT_EQ(1u, poolAllocator->mediumBufferPools.size());
+    EXPECT_FALSE(static_cast<MockBuffer *>(buffers[buffersToCreate].get())->isSubBuffer());
+
+    const auto &statistics = poolAllocator->getPoolTierStatistics(PoolAllocator::PoolTier::medium);
+    EXPECT_EQ(buffersToCreate, statistics.buffersAllocated);
+    EXPECT_EQ(1u, statistics.allocationFailures);
+}
+
+TEST_F(AggregatedMediumBuffersEnabledTest, givenMultipleMediumPoolsWhenAllBuffersFreedAndPoolsDrainedThenEmptyPoolsAreReleasedExceptOne) {
+    poolAllocator->maxMediumPoolCount = 2u;
+    size = mediumTierParams.threshold;
+    constexpr auto buffersToCreate = 2 * (mediumTierParams.poolSize / mediumTierParams.threshold);
+    std::vector<std::unique_ptr<Buffer>> buffers(buffersToCreate);
+    for (auto i = 0u; i < buffersToCreate; i++) {
+        buffers[i].reset(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+        EXPECT_EQ(retVal, CL_SUCCESS);
+    }
+    EXPECT_EQ(2u, poolAllocator->mediumBufferPools.size());
+
+    buffers.clear();
+    mockMemoryManager->deferAllocInUse = false;
+    auto contextRefCount = context->getRefInternalCount();
+
+    std::unique_ptr<Buffer> bufferAfterFree(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_EQ(retVal, CL_SUCCESS);
+    EXPECT_TRUE(static_cast<MockBuffer *>(bufferAfterFree.get())->isSubBuffer());
+    EXPECT_EQ(1u, poolAllocator->mediumBufferPools.size());
+    EXPECT_EQ(size, poolAllocator->mediumBufferPools[0].chunkAllocator->getUsedSize());
+    EXPECT_EQ(contextRefCount + 1, context->getRefInternalCount());
+
+    const auto &statistics = poolAllocator->getPoolTierStatistics(PoolAllocator::PoolTier::medium);
+    EXPECT_EQ(2u, statistics.poolsCreated);
+    EXPECT_EQ(1u, statistics.poolsReleased);
+}
+
+TEST_F(AggregatedMediumBuffersEnabledTest, givenMediumBuffersTierEnabledWhenSmallBufferPoolIsExhaustedThenNewSmallPoolIsNotAllocatedFromMediumPool) {
+    static_assert(PoolAllocator::aggregatedSmallBuffersPoolSize <= mediumTierParams.threshold, "Small pool storage needs to be within medium threshold");
+    this->poolAllocator->maxPoolCount = 2u;
+    size = PoolAllocator::smallBufferThreshold;
+
+    constexpr auto buffersToCreate = PoolAllocator::aggregatedSmallBuffersPoolSize / PoolAllocator::smallBufferThreshold;
+    std::vector<std::unique_ptr<Buffer>> buffers(buffersToCreate);
+    for (auto i = 0u; i < buffersToCreate; i++) {
+        buffers[i].reset(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+        EXPECT_EQ(retVal, CL_SUCCESS);
+    }
+    mockMemoryManager->deferAllocInUse = true;
+
+    std::unique_ptr<Buffer> bufferAfterExhaustMustSucceed(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_EQ(retVal, CL_SUCCESS);
+    ASSERT_EQ(2u, poolAllocator->bufferPools.size());
+    EXPECT_FALSE(poolAllocator->bufferPools[1].mainStorage->isSubBuffer());
+    EXPECT_EQ(size, poolAllocator->bufferPools[1].chunkAllocator->getUsedSize());
+    EXPECT_TRUE(poolAllocator->mediumBufferPools.empty());
+    EXPECT_EQ(0u, poolAllocator->getPoolTierStatistics(PoolAllocator::PoolTier::medium).buffersAllocated);
+}
+
 using AggregatedSmallBuffersEnabledTestFailPoolInit = AggregatedSmallBuffersTestTemplate<1, true>;
 
 TEST_F(AggregatedSmallBuffersEnabledTestFailPoolInit, givenAggregatedSmallBuffersEnabledAndSizeEqualToThresholdWhenBufferCreateCalledButPoolCreateFailedThenDoNotUsePool) {
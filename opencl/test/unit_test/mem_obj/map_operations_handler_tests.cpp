@@ -82,27 +82,27 @@ TEST_F(MapOperationsHandlerTests, givenMappedPtrsWhenDoubleRemovedThenDoNothing)
 TEST_F(MapOperationsHandlerTests, givenMapInfoWhenAddedThenSetReadOnlyFlag) {
     mapFlags = CL_MAP_READ;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.find(mappedPtrs[0].ptr)->readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.find(mappedPtrs[0].ptr)->readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.find(mappedPtrs[0].ptr)->readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.find(mappedPtrs[0].ptr)->readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.find(mappedPtrs[0].ptr)->readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 }
 
@@ -112,7 +112,7 @@ TEST_F(MapOperationsHandlerTests, givenNonReadOnlyOverlappingPtrWhenAddingThenRe
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.find(mappedPtrs[0].ptr)->readOnly);
     EXPECT_TRUE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_FALSE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
     EXPECT_EQ(1u, mockHandler.size());
@@ -124,11 +124,11 @@ TEST_F(MapOperationsHandlerTests, givenReadOnlyOverlappingPtrWhenAddingThenRetur
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.find(mappedPtrs[0].ptr)->readOnly);
     EXPECT_FALSE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_TRUE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
     EXPECT_EQ(2u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.find(mappedPtrs[0].ptr)->readOnly);
 }
 
 const std::tuple<void *, size_t, void *, size_t, bool> overlappingCombinations[] = {
@@ -169,8 +169,50 @@ INSTANTIATE_TEST_SUITE_P(MapOperationsHandlerOverlapTests,
                          MapOperationsHandlerOverlapTests,
                          ::testing::ValuesIn(overlappingCombinations));
 
+TEST_F(MapOperationsHandlerTests, givenMultipleMappingsWhenFindingInfoForHostPtrThenReturnMappingContainingWholeRange) {
+    MapInfo mappings[3] = {
+        {(void *)0x1000, 0x100, {{0, 0, 0}}, {{0, 0, 0}}, 0},
+        {(void *)0x2000, 0x100, {{0, 0, 0}}, {{0, 0, 0}}, 0},
+        {(void *)0x3000, 0x100, {{0, 0, 0}}, {{0, 0, 0}}, 0},
+    };
+    for (size_t i = 0; i < 3; i++) {
+        EXPECT_TRUE(mockHandler.add(mappings[i].ptr, mappings[i].ptrLength, mapFlags, mappings[i].size, mappings[i].offset, 0, allocations[i].get()));
+    }
+
+    MapInfo receivedMapInfo;
+    EXPECT_TRUE(mockHandler.findInfoForHostPtr((void *)0x2010, 0x10, receivedMapInfo));
+    EXPECT_EQ(mappings[1].ptr, receivedMapInfo.ptr);
+    EXPECT_EQ(allocations[1].get(), receivedMapInfo.graphicsAllocation);
+
+    EXPECT_TRUE(mockHandler.findInfoForHostPtr((void *)0x3000, 0x100, receivedMapInfo));
+    EXPECT_EQ(mappings[2].ptr, receivedMapInfo.ptr);
+
+    EXPECT_FALSE(mockHandler.findInfoForHostPtr((void *)0x20f0, 0x20, receivedMapInfo));
+    EXPECT_FALSE(mockHandler.findInfoForHostPtr((void *)0x500, 0x10, receivedMapInfo));
+
+    mockHandler.remove(mappings[1].ptr);
+    EXPECT_FALSE(mockHandler.findInfoForHostPtr((void *)0x2010, 0x10, receivedMapInfo));
+}
+
+TEST_F(MapOperationsHandlerTests, givenManyNonOverlappingWriteMappingsWhenAddingOverlappingOneThenReturnFalse) {
+    mapFlags = CL_MAP_WRITE;
+    constexpr size_t mappingsCount = 256;
+    constexpr size_t mappingSize = 0x100;
+    MemObjSizeArray size = {{0, 0, 0}};
+    MemObjOffsetArray offset = {{0, 0, 0}};
+    for (size_t i = 0; i < mappingsCount; i++) {
+        EXPECT_TRUE(mockHandler.add(reinterpret_cast<void *>(0x10000 + 2 * i * mappingSize), mappingSize, mapFlags, size, offset, 0, nullptr));
+    }
+    EXPECT_EQ(mappingsCount, mockHandler.size());
+
+    EXPECT_FALSE(mockHandler.add(reinterpret_cast<void *>(0x10000 + 101 * mappingSize - 1), 2, mapFlags, size, offset, 0, nullptr));
+    EXPECT_TRUE(mockHandler.add(reinterpret_cast<void *>(0x10000 + 101 * mappingSize + 1), 2, mapFlags, size, offset, 0, nullptr));
+    EXPECT_EQ(mappingsCount + 1, mockHandler.size());
+}
+
 struct MapOperationsStorageWhitebox : MapOperationsStorage {
     using MapOperationsStorage::handlers;
+    using MapOperationsStorage::mappedPointers;
 };
 
 TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenGetHandlerIsUsedThenCreateHandler) {
@@ -221,3 +263,33 @@ TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenRemoveHandlerIsUsedT
     storage.removeHandler(&buffer);
     EXPECT_EQ(0u, storage.handlers.size());
 }
+
+TEST(MapOperationsStorageTest, givenMappingsInMultipleHandlersWhenGetInfoForHostPtrIsUsedThenReturnMappingFromCorrectHandler) {
+    MockBuffer buffer1{};
+    MockBuffer buffer2{};
+    MockGraphicsAllocation allocation1{};
+    MockGraphicsAllocation allocation2{};
+    MapOperationsStorageWhitebox storage{};
+    cl_map_flags mapFlags = CL_MAP_WRITE;
+    MemObjSizeArray size = {{0, 0, 0}};
+    MemObjOffsetArray offset = {{0, 0, 0}};
+
+    EXPECT_TRUE(storage.getHandler(&buffer1).add((void *)0x1000, 0x100, mapFlags, size, offset, 0, &allocation1));
+    EXPECT_TRUE(storage.getHandler(&buffer2).add((void *)0x2000, 0x100, mapFlags, size, offset, 0, &allocation2));
+    EXPECT_EQ(2u, storage.mappedPointers.size());
+
+    MapInfo receivedMapInfo;
+    EXPECT_TRUE(storage.getInfoForHostPtr((void *)0x2080, 0x10, receivedMapInfo));
+    EXPECT_EQ(&allocation2, receivedMapInfo.graphicsAllocation);
+    EXPECT_TRUE(storage.getInfoForHostPtr((void *)0x1000, 0x10, receivedMapInfo));
+    EXPECT_EQ(&allocation1, receivedMapInfo.graphicsAllocation);
+    EXPECT_FALSE(storage.getInfoForHostPtr((void *)0x1f00, 0x200, receivedMapInfo));
+
+    storage.getHandler(&buffer1).remove((void *)0x1000);
+    EXPECT_FALSE(storage.getInfoForHostPtr((void *)0x1000, 0x10, receivedMapInfo));
+    EXPECT_EQ(1u, storage.mappedPointers.size());
+
+    storage.removeHandler(&buffer2);
+    EXPECT_FALSE(storage.getInfoForHostPtr((void *)0x2080, 0x10, receivedMapInfo));
+    EXPECT_EQ(0u, storage.mappedPointers.size());
+}
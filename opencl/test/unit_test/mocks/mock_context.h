@@ -59,7 +59,9 @@ class MockContext : public Context {
         using BufferPoolAllocator::bufferPools;
         using BufferPoolAllocator::calculateMaxPoolCount;
         using BufferPoolAllocator::isAggregatedSmallBuffersEnabled;
+        using BufferPoolAllocator::maxMediumPoolCount;
         using BufferPoolAllocator::maxPoolCount;
+        using BufferPoolAllocator::mediumBufferPools;
     };
 
   private:
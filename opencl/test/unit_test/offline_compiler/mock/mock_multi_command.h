@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,8 @@ namespace NEO {
 class MockMultiCommand : public MultiCommand {
   public:
     using MultiCommand::argHelper;
+    using MultiCommand::buildTimes;
+    using MultiCommand::concurrentBuilds;
     using MultiCommand::lines;
     using MultiCommand::quiet;
     using MultiCommand::retValues;
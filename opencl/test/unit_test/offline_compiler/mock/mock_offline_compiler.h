@@ -26,6 +26,8 @@ class MockOfflineCompiler : public OfflineCompiler {
     using OfflineCompiler::argHelper;
     using OfflineCompiler::binaryOutputFile;
     using OfflineCompiler::cache;
+    using OfflineCompiler::cacheHits;
+    using OfflineCompiler::cacheMisses;
     using OfflineCompiler::compilerProductHelper;
     using OfflineCompiler::dbgHash;
     using OfflineCompiler::debugDataBinary;
@@ -1776,6 +1776,107 @@ TEST_F(OclocFatBinaryTest, givenBitFlagsWhenBuildingFatbinaryThenFilesInArchiveH
     }
 }
 
+TEST_F(OclocFatBinaryTest, givenConcurrentBuildsFlagWhenBuildingFatbinaryThenArchiveIsSameAsForSerialBuild) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+
+    std::vector<std::string> args = {
+        "ocloc",
+        "-output",
+        outputArchiveName,
+        "-file",
+        spirvFilename,
+        "-output_no_suffix",
+        "-spirv_input",
+        "-device",
+        devices};
+
+    mockArgHelper.getPrinterRef().setSuppressMessages(true);
+    ASSERT_EQ(OCLOC_SUCCESS, buildFatBinary(args, &mockArgHelper));
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+    const auto serialArchive = mockArgHelper.interceptedFiles[outputArchiveName];
+    mockArgHelper.interceptedFiles.clear();
+
+    args.push_back("-j");
+    args.push_back("2");
+    ASSERT_EQ(OCLOC_SUCCESS, buildFatBinary(args, &mockArgHelper));
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+    EXPECT_EQ(serialArchive, mockArgHelper.interceptedFiles[outputArchiveName]);
+}
+
+TEST_F(OclocFatBinaryTest, givenConcurrentBuildsFlagWhenBuildingFatbinaryThenBuildTimeIsReportedForEachTarget) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+
+    const std::vector<std::string> args = {
+        "ocloc",
+        "-output",
+        outputArchiveName,
+        "-file",
+        spirvFilename,
+        "-output_no_suffix",
+        "-spirv_input",
+        "-j",
+        "2",
+        "-device",
+        devices};
+
+    mockArgHelper.getPrinterRef().setSuppressMessages(true);
+    ASSERT_EQ(OCLOC_SUCCESS, buildFatBinary(args, &mockArgHelper));
+
+    const auto log = mockArgHelper.getPrinterRef().getLog().str();
+    const std::string buildTimeMessage = "Build time for : ";
+    size_t buildTimeMessagesCount = 0u;
+    for (auto position = log.find(buildTimeMessage); position != std::string::npos; position = log.find(buildTimeMessage, position + 1)) {
+        buildTimeMessagesCount++;
+    }
+    EXPECT_EQ(2u, buildTimeMessagesCount);
+}
+
+TEST_F(OclocFatBinaryTest, givenConcurrentBuildsFlagWhenTargetsPrintMessagesDuringBuildThenMessagesArePrintedInTargetOrder) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+
+    const std::vector<std::string> args = {
+        "ocloc",
+        "-output",
+        outputArchiveName,
+        "-file",
+        spirvFilename,
+        "-output_no_suffix",
+        "-llvm_input",
+        "-j",
+        "2",
+        "-device",
+        devices};
+
+    mockArgHelper.getPrinterRef().setSuppressMessages(true);
+    ASSERT_EQ(OCLOC_SUCCESS, buildFatBinary(args, &mockArgHelper));
+
+    const auto log = mockArgHelper.getPrinterRef().getLog().str();
+    const std::string warningMessage = "Warning : file does not look like llvm bitcode (wrong magic numbers)";
+    const std::string buildSucceededMessage = "Build succeeded for : ";
+
+    const auto firstWarning = log.find(warningMessage);
+    const auto firstBuildSucceeded = log.find(buildSucceededMessage);
+    ASSERT_NE(std::string::npos, firstWarning);
+    ASSERT_NE(std::string::npos, firstBuildSucceeded);
+    EXPECT_LT(firstWarning, firstBuildSucceeded);
+
+    const auto secondWarning = log.find(warningMessage, firstWarning + 1);
+    const auto secondBuildSucceeded = log.find(buildSucceededMessage, firstBuildSucceeded + 1);
+    ASSERT_NE(std::string::npos, secondWarning);
+    ASSERT_NE(std::string::npos, secondBuildSucceeded);
+    EXPECT_LT(firstBuildSucceeded, secondWarning);
+    EXPECT_LT(secondWarning, secondBuildSucceeded);
+}
+
 TEST_F(OclocFatBinaryTest, givenOutputDirectoryFlagWhenBuildingFatbinaryThenArchiveIsStoredInThatDirectory) {
     const auto devices = prepareTwoDevices(&mockArgHelper);
     if (devices.empty()) {
@@ -325,6 +325,101 @@ TEST_F(MultiCommandTests, GivenOutputFileListFlagWhenBuildingMultiCommandThenSuc
     delete pMultiCommand;
 }
 
+TEST_F(MultiCommandTests, GivenConcurrentBuildsWhenBuildingMultiCommandThenOutputFileListMatchesSerialBuilds) {
+    nameOfFileWithArgs = "ImAMulitiComandMinimalGoodFile.txt";
+    std::vector<std::string> singleArgs = {
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    int numOfBuild = 4;
+    createFileWithArgs(singleArgs, numOfBuild);
+
+    std::vector<std::string> serialArgv = {
+        "ocloc",
+        "multi",
+        nameOfFileWithArgs.c_str(),
+        "-q",
+        "-output_file_list",
+        "outFileList.txt",
+    };
+    pMultiCommand = MultiCommand::create(serialArgv, retVal, oclocArgHelperWithoutInput.get());
+    EXPECT_NE(nullptr, pMultiCommand);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    outFileList = pMultiCommand->outputFileList;
+    const auto serialOutputFileList = readBinaryFile(outFileList);
+    deleteOutFileList();
+    delete pMultiCommand;
+
+    std::vector<std::string> concurrentArgv = serialArgv;
+    concurrentArgv.push_back("-j");
+    concurrentArgv.push_back("3");
+    pMultiCommand = MultiCommand::create(concurrentArgv, retVal, oclocArgHelperWithoutInput.get());
+    EXPECT_NE(nullptr, pMultiCommand);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    const auto concurrentOutputFileList = readBinaryFile(outFileList);
+
+    EXPECT_FALSE(serialOutputFileList.empty());
+    EXPECT_EQ(serialOutputFileList, concurrentOutputFileList);
+
+    deleteFileWithArgs();
+    deleteOutFileList();
+    delete pMultiCommand;
+}
+
+TEST(MultiCommandWhiteboxTest, GivenConcurrentBuildsWhenBuildingThenLogsArePrintedInCommandOrder) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.quiet = false;
+    mockMultiCommand.concurrentBuilds = 4u;
+    mockMultiCommand.lines = {"-file a.cl -device dev", "-file b.cl -device dev", "-file c.cl -device dev"};
+
+    ::testing::internal::CaptureStdout();
+    mockMultiCommand.runBuilds("ocloc");
+    const auto output = testing::internal::GetCapturedStdout();
+
+    ASSERT_EQ(3u, mockMultiCommand.retValues.size());
+    EXPECT_EQ(3u, mockMultiCommand.buildTimes.size());
+    const auto firstCommand = output.find("Command number 1: ");
+    const auto secondCommand = output.find("Command number 2: ");
+    const auto thirdCommand = output.find("Command number 3: ");
+    ASSERT_NE(std::string::npos, thirdCommand);
+    EXPECT_LT(firstCommand, secondCommand);
+    EXPECT_LT(secondCommand, thirdCommand);
+}
+
+TEST(MultiCommandWhiteboxTest, GivenVerboseOptionInCommandLineWhenRunningConcurrentBuildsThenArgHelperIsSetVerboseBeforeBuilds) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.quiet = true;
+    mockMultiCommand.callBaseSingleBuild = false;
+    mockMultiCommand.concurrentBuilds = 2u;
+    mockMultiCommand.lines = {"-file a.cl -device dev", "-file b.cl -device dev -v"};
+
+    EXPECT_FALSE(mockMultiCommand.argHelper->isVerbose());
+    mockMultiCommand.runBuilds("ocloc");
+
+    EXPECT_EQ(2, mockMultiCommand.singleBuildCalledCount);
+    EXPECT_TRUE(mockMultiCommand.argHelper->isVerbose());
+}
+
+TEST(MultiCommandWhiteboxTest, GivenBuildTimesWhenShowingResultsThenWallTimeIsPrintedForEachBuild) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.retValues = {OCLOC_SUCCESS, OCLOC_SUCCESS};
+    mockMultiCommand.buildTimes = {std::chrono::milliseconds(12), std::chrono::milliseconds(34)};
+    mockMultiCommand.quiet = false;
+
+    ::testing::internal::CaptureStdout();
+    const auto result = mockMultiCommand.showResults();
+    const auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(OCLOC_SUCCESS, result);
+    const auto expectedOutput{"Build command 0: successful\n"
+                              "Build command 1: successful\n"
+                              "Build command 0: wall time: 12 ms\n"
+                              "Build command 1: wall time: 34 ms\n"};
+    EXPECT_EQ(expectedOutput, output);
+}
+
 TEST(MultiCommandWhiteboxTest, GivenVerboseModeWhenShowingResultsThenLogsArePrintedForEachBuild) {
     MockMultiCommand mockMultiCommand{};
     mockMultiCommand.retValues = {OCLOC_SUCCESS, OCLOC_INVALID_FILE};
@@ -394,6 +489,9 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <count>                    Runs up to <count> builds concurrently.
+                                Logs of builds are printed in command file order.
+
 )===";
 
     EXPECT_EQ(expectedOutput, output);
@@ -2474,6 +2572,99 @@ TEST(OfflineCompilerTest, GivenAllowCachingWhenBuildingThenBinaryIsCached) {
     EXPECT_NE(cacheMock->cacheInvoked, 0u);
 }
 
+TEST(OfflineCompilerTest, GivenVerboseOptionWhenInitializingThenVerbosityIsKeptPerCompiler) {
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str(),
+        "-v"};
+
+    auto mockOfflineCompiler = std::unique_ptr<MockOfflineCompiler>(new MockOfflineCompiler());
+    mockOfflineCompiler->interceptCreatedDirs = true;
+    auto retVal = mockOfflineCompiler->initialize(argv.size(), argv);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_TRUE(mockOfflineCompiler->isVerbose());
+    EXPECT_FALSE(mockOfflineCompiler->argHelper->isVerbose());
+}
+
+TEST(OfflineCompilerTest, GivenAllowCachingAndVerboseModeWhenBuildingThenCacheStatisticsArePrinted) {
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str(),
+        "-allow_caching",
+        "-v"};
+
+    {
+        auto mockOfflineCompiler = std::unique_ptr<MockOfflineCompiler>(new MockOfflineCompiler());
+        mockOfflineCompiler->interceptCreatedDirs = true;
+        auto retVal = mockOfflineCompiler->initialize(argv.size(), argv);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        mockOfflineCompiler->dumpFiles = false;
+        mockOfflineCompiler->cache.reset(new CompilerCacheMock());
+
+        ::testing::internal::CaptureStdout();
+        retVal = mockOfflineCompiler->build();
+        const auto output = testing::internal::GetCapturedStdout();
+
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        EXPECT_EQ(0u, mockOfflineCompiler->cacheHits);
+        EXPECT_NE(0u, mockOfflineCompiler->cacheMisses);
+        const auto expectedStatistics = "Cache hits: 0, cache misses: " + std::to_string(mockOfflineCompiler->cacheMisses) + "\n";
+        EXPECT_TRUE(hasSubstr(output, expectedStatistics)) << output;
+    }
+    {
+        auto mockOfflineCompiler = std::unique_ptr<MockOfflineCompiler>(new MockOfflineCompiler());
+        mockOfflineCompiler->interceptCreatedDirs = true;
+        auto retVal = mockOfflineCompiler->initialize(argv.size(), argv);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        mockOfflineCompiler->dumpFiles = false;
+        auto cacheMock = new CompilerCacheMock();
+        cacheMock->loadResult = true;
+        mockOfflineCompiler->cache.reset(cacheMock);
+
+        ::testing::internal::CaptureStdout();
+        retVal = mockOfflineCompiler->build();
+        const auto output = testing::internal::GetCapturedStdout();
+
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        EXPECT_NE(0u, mockOfflineCompiler->cacheHits);
+        EXPECT_EQ(0u, mockOfflineCompiler->cacheMisses);
+        EXPECT_EQ(0u, cacheMock->cacheInvoked);
+        const auto expectedStatistics = "Cache hits: " + std::to_string(mockOfflineCompiler->cacheHits) + ", cache misses: 0\n";
+        EXPECT_TRUE(hasSubstr(output, expectedStatistics)) << output;
+    }
+}
+
+TEST(OfflineCompilerTest, GivenAllowCachingWithoutVerboseModeWhenBuildingThenCacheStatisticsAreNotPrinted) {
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str(),
+        "-allow_caching"};
+
+    auto mockOfflineCompiler = std::unique_ptr<MockOfflineCompiler>(new MockOfflineCompiler());
+    mockOfflineCompiler->interceptCreatedDirs = true;
+    auto retVal = mockOfflineCompiler->initialize(argv.size(), argv);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    mockOfflineCompiler->dumpFiles = false;
+    mockOfflineCompiler->cache.reset(new CompilerCacheMock());
+
+    ::testing::internal::CaptureStdout();
+    retVal = mockOfflineCompiler->build();
+    const auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_FALSE(hasSubstr(output, "Cache hits:")) << output;
+}
+
 TEST(OfflineCompilerTest, GivenCachedBinaryWhenBuildIrBinaryThenIrBinaryIsLoaded) {
     std::vector<std::string> argv = {
         "ocloc",
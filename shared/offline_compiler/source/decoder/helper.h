@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 #include "igfxfmid.h"
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -39,6 +40,11 @@ class MessagePrinter : NEO::NonCopyableOrMovableClass {
     explicit MessagePrinter(bool suppressMessages) : suppressMessages(suppressMessages) {}
 
     void printf(const char *message) {
+        if (threadMessages != nullptr) {
+            *threadMessages << message;
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
         if (!suppressMessages) {
             ::printf("%s", message);
         }
@@ -47,6 +53,11 @@ class MessagePrinter : NEO::NonCopyableOrMovableClass {
 
     template <typename... Args>
     void printf(const char *format, Args... args) {
+        if (threadMessages != nullptr) {
+            *threadMessages << stringFormat(format, args...);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
         if (!suppressMessages) {
             ::printf(format, args...);
         }
@@ -58,6 +69,12 @@ class MessagePrinter : NEO::NonCopyableOrMovableClass {
     }
 
     bool isSuppressed() const { return suppressMessages; }
+
+    // Messages printed from the calling thread are collected in given log instead, until reset with nullptr.
+    static void redirectThreadMessages(std::stringstream *log) {
+        threadMessages = log;
+    }
+
     void setSuppressMessages(bool suppress) {
         suppressMessages = suppress;
     }
@@ -75,6 +92,8 @@ class MessagePrinter : NEO::NonCopyableOrMovableClass {
         return outputString.c_str();
     }
 
+    static inline thread_local std::stringstream *threadMessages = nullptr;
     std::stringstream ss;
+    std::mutex mutex;
     bool suppressMessages = false;
 };
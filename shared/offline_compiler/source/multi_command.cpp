@@ -15,7 +15,10 @@
 #include "shared/offline_compiler/source/utilities/safety_caller.h"
 #include "shared/source/utilities/const_stringref.h"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <thread>
 
 namespace NEO {
 int MultiCommand::singleBuild(const std::vector<std::string> &args) {
@@ -26,7 +29,7 @@ int MultiCommand::singleBuild(const std::vector<std::string> &args) {
     } else {
         std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(args.size(), args, true, retVal, argHelper)};
         if (retVal == OCLOC_SUCCESS) {
-            retVal = buildWithSafetyGuard(pCompiler.get());
+            retVal = useSafetyGuard ? buildWithSafetyGuard(pCompiler.get()) : pCompiler->build();
 
             std::string &buildLog = pCompiler->getBuildLog();
             if (buildLog.empty() == false) {
@@ -109,6 +112,8 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
             outputFileList = args[++argIndex];
         } else if (ConstStringRef("-q") == currArg) {
             quiet = true;
+        } else if (hasMoreArgs && ConstStringRef("-j") == currArg) {
+            concurrentBuilds = static_cast<size_t>(std::max(atoi(args[++argIndex].c_str()), 1));
         } else {
             argHelper->printf("Invalid option (arg %zu): %s\n", argIndex, currArg.c_str());
             printHelp();
@@ -138,6 +143,11 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
 }
 
 void MultiCommand::runBuilds(const std::string &argZero) {
+    if (concurrentBuilds > 1u) {
+        runBuildsConcurrently(argZero);
+        return;
+    }
+
     for (size_t i = 0; i < lines.size(); ++i) {
         std::vector<std::string> args = {argZero};
 
@@ -157,6 +167,92 @@ void MultiCommand::runBuilds(const std::string &argZero) {
     }
 }
 
+void MultiCommand::runBuildsConcurrently(const std::string &argZero) {
+    struct PendingBuild {
+        std::vector<std::string> args;
+        std::unique_ptr<MultiCommand> command;
+        std::stringstream log;
+        std::chrono::milliseconds buildTime{0};
+        int retVal = OCLOC_SUCCESS;
+        bool runOnWorker = false;
+    };
+
+    // Command lines are prepared serially, as output names depend on shared state.
+    // Each build gets its own command object, so that output file list entries do not interleave.
+    // Safety guard relies on process-wide signal handlers, so workers build without it and
+    // fat binary builds (which always use it) are run on this thread after workers finish.
+    std::vector<PendingBuild> builds(lines.size());
+    for (size_t i = 0; i < lines.size(); ++i) {
+        auto &build = builds[i];
+        build.args.push_back(argZero);
+        build.retVal = splitLineInSeparateArgs(build.args, lines[i], i);
+        if (build.retVal != OCLOC_SUCCESS) {
+            continue;
+        }
+
+        addAdditionalOptionsToSingleCommandLine(build.args, i);
+        build.command.reset(new MultiCommand());
+        build.command->argHelper = argHelper;
+        build.command->quiet = quiet;
+        build.command->outDirForBuilds = outDirForBuilds;
+        build.command->outFileName = outFileName;
+        build.runOnWorker = !requestedFatBinary(build.args, argHelper);
+        build.command->useSafetyGuard = !build.runOnWorker;
+        // Compilers keep verbosity per instance, shared helper is only updated here before workers start
+        if (std::find(build.args.begin(), build.args.end(), "-v") != build.args.end()) {
+            argHelper->setVerbose(true);
+        }
+    }
+
+    auto runBuild = [](PendingBuild &build) {
+        MessagePrinter::redirectThreadMessages(&build.log);
+        const auto start = std::chrono::steady_clock::now();
+        build.retVal = build.command->singleBuild(build.args);
+        build.buildTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        MessagePrinter::redirectThreadMessages(nullptr);
+    };
+
+    std::atomic<size_t> nextBuild{0u};
+    auto worker = [&builds, &nextBuild, &runBuild]() {
+        for (auto i = nextBuild++; i < builds.size(); i = nextBuild++) {
+            if (builds[i].runOnWorker) {
+                runBuild(builds[i]);
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    const auto workersCount = std::min(concurrentBuilds, builds.size());
+    for (size_t i = 0; i < workersCount; ++i) {
+        workers.emplace_back(worker);
+    }
+    for (auto &thread : workers) {
+        thread.join();
+    }
+    for (auto &build : builds) {
+        if (build.command && !build.runOnWorker) {
+            runBuild(build);
+        }
+    }
+
+    for (size_t i = 0; i < builds.size(); ++i) {
+        auto &build = builds[i];
+        retValues.push_back(build.retVal);
+        buildTimes.push_back(build.buildTime);
+        if (build.command == nullptr) {
+            continue;
+        }
+        if (!quiet) {
+            argHelper->printf("Command number %zu: \n", i + 1);
+        }
+        const auto log = build.log.str();
+        if (!log.empty()) {
+            argHelper->printf(log.c_str());
+        }
+        outputFile << build.command->outputFile.str();
+    }
+}
+
 void MultiCommand::printHelp() {
     argHelper->printf(R"===(Compiles multiple files using a config file.
 
@@ -172,6 +268,9 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <count>                    Runs up to <count> builds concurrently.
+                                Logs of builds are printed in command file order.
+
 )===");
 }
 
@@ -217,6 +316,11 @@ int MultiCommand::showResults() {
         }
         indexRetVal++;
     }
+    if (!quiet && !buildTimes.empty()) {
+        for (size_t i = 0; i < buildTimes.size(); ++i) {
+            argHelper->printf("Build command %zu: wall time: %lld ms\n", i, static_cast<long long>(buildTimes[i].count()));
+        }
+    }
     return retValue;
 }
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -36,13 +37,17 @@ class MultiCommand {
     void addAdditionalOptionsToSingleCommandLine(std::vector<std::string> &, size_t buildId);
     void printHelp();
     void runBuilds(const std::string &argZero);
+    void runBuildsConcurrently(const std::string &argZero);
 
     OclocArgHelper *argHelper = nullptr;
     std::vector<int> retValues;
+    std::vector<std::chrono::milliseconds> buildTimes;
     std::vector<std::string> lines;
     std::string outFileName;
     std::string pathToCommandFile;
     std::stringstream outputFile;
+    size_t concurrentBuilds = 1u;
     bool quiet = false;
+    bool useSafetyGuard = true;
 };
 } // namespace NEO
@@ -208,6 +208,7 @@ void OclocArgHelper::setHwInfoForHwInfoConfig(NEO::HardwareInfo &hwInfo, uint64_
 
 void OclocArgHelper::saveOutput(const std::string &filename, const void *pData, const size_t &dataSize) {
     if (outputEnabled()) {
+        std::lock_guard<std::mutex> lock(outputsMutex);
         addOutput(filename, pData, dataSize);
     } else {
         writeDataToFile(filename.c_str(), pData, dataSize);
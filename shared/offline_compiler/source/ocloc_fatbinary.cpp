@@ -26,10 +26,15 @@
 #include "platforms.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
 #include <set>
+#include <sstream>
+#include <thread>
 
 namespace NEO {
 
@@ -286,22 +291,28 @@ int getDeviceArgValueIdx(const std::vector<std::string> &args) {
 int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
                             OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
 
+    if (retVal) {
+        return retVal;
+    }
+    retVal = buildWithSafetyGuard(pCompiler);
+    return appendBuildResultToFatBinary(retVal, argsCopy, pointerSize, fatbinary, pCompiler, argHelper, product);
+}
+
+int appendBuildResultToFatBinary(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
+                                 OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
+    std::string buildLog = pCompiler->getBuildLog();
+    if (buildLog.empty() == false) {
+        argHelper->printf("%s\n", buildLog.c_str());
+    }
     if (retVal == 0) {
-        retVal = buildWithSafetyGuard(pCompiler);
-        std::string buildLog = pCompiler->getBuildLog();
-        if (buildLog.empty() == false) {
-            argHelper->printf("%s\n", buildLog.c_str());
-        }
-        if (retVal == 0) {
-            if (!pCompiler->isQuiet())
-                argHelper->printf("Build succeeded for : %s.\n", product.c_str());
-        } else {
-            argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), retVal);
-            argHelper->printf("Command was:");
-            for (const auto &arg : argsCopy)
-                argHelper->printf(" %s", arg.c_str());
-            argHelper->printf("\n");
-        }
+        if (!pCompiler->isQuiet())
+            argHelper->printf("Build succeeded for : %s.\n", product.c_str());
+    } else {
+        argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), retVal);
+        argHelper->printf("Command was:");
+        for (const auto &arg : argsCopy)
+            argHelper->printf(" %s", arg.c_str());
+        argHelper->printf("\n");
     }
     if (retVal) {
         return retVal;
@@ -326,6 +337,73 @@ int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy
     return retVal;
 }
 
+int buildFatBinaryForTargetsConcurrently(const std::vector<std::string> &argsCopy, size_t deviceArgIndex, const std::vector<ConstStringRef> &targetProducts, size_t concurrentBuilds,
+                                         std::string pointerSize, Ar::ArEncoder &fatbinary, std::string &optionsForIr, OclocArgHelper *argHelper) {
+    struct TargetBuild {
+        std::vector<std::string> args;
+        std::unique_ptr<OfflineCompiler> compiler;
+        int retVal = OCLOC_SUCCESS;
+        std::chrono::milliseconds buildTime{0};
+        std::stringstream log;
+    };
+
+    std::vector<TargetBuild> targetBuilds(targetProducts.size());
+    for (size_t i = 0; i < targetProducts.size(); i++) {
+        int retVal = 0;
+        targetBuilds[i].args = argsCopy;
+        targetBuilds[i].args[deviceArgIndex] = targetProducts[i].str();
+
+        targetBuilds[i].compiler.reset(OfflineCompiler::create(targetBuilds[i].args.size(), targetBuilds[i].args, false, retVal, argHelper));
+        if (OCLOC_SUCCESS != retVal) {
+            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+            return retVal;
+        }
+        if (targetBuilds[i].compiler->isVerbose()) {
+            argHelper->setVerbose(true);
+        }
+    }
+
+    // Crash guard relies on process wide signal handlers, so worker threads call build directly.
+    // Messages of each build are collected separately and printed in target order after all builds finish.
+    std::atomic<size_t> nextTarget{0u};
+    auto buildTargets = [&targetBuilds, &nextTarget]() {
+        for (auto i = nextTarget++; i < targetBuilds.size(); i = nextTarget++) {
+            MessagePrinter::redirectThreadMessages(&targetBuilds[i].log);
+            const auto buildStart = std::chrono::steady_clock::now();
+            targetBuilds[i].retVal = targetBuilds[i].compiler->build();
+            targetBuilds[i].buildTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - buildStart);
+            MessagePrinter::redirectThreadMessages(nullptr);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < std::min(concurrentBuilds, targetBuilds.size()); i++) {
+        workers.emplace_back(buildTargets);
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    for (size_t i = 0; i < targetBuilds.size(); i++) {
+        auto &targetBuild = targetBuilds[i];
+        const auto log = targetBuild.log.str();
+        if (!log.empty()) {
+            argHelper->printf(log.c_str());
+        }
+        auto retVal = appendBuildResultToFatBinary(targetBuild.retVal, targetBuild.args, pointerSize, fatbinary, targetBuild.compiler.get(), argHelper, targetProducts[i].str());
+        if (retVal) {
+            return retVal;
+        }
+        if (!targetBuild.compiler->isQuiet()) {
+            argHelper->printf("Build time for : %s: %lld ms.\n", targetProducts[i].str().c_str(), static_cast<long long>(targetBuild.buildTime.count()));
+        }
+        if (optionsForIr.empty()) {
+            optionsForIr = targetBuild.compiler->getOptions();
+        }
+    }
+    return OCLOC_SUCCESS;
+}
+
 int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelper) {
     std::string pointerSizeInBits = (sizeof(void *) == 4) ? "32" : "64";
     size_t deviceArgIndex = -1;
@@ -334,6 +412,7 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
     std::string outputDirectory = "";
     bool spirvInput = false;
     bool excludeIr = false;
+    size_t concurrentBuilds = 1u;
     std::set<std::string> deviceAcronymsFromDeviceOptions;
 
     std::vector<std::string> argsCopy(args);
@@ -361,6 +440,9 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
             excludeIr = true;
         } else if (ConstStringRef("-spirv_input") == currArg) {
             spirvInput = true;
+        } else if ((ConstStringRef("-j") == currArg) && hasMoreArgs) {
+            concurrentBuilds = static_cast<size_t>(std::max(1, atoi(args[argIndex + 1].c_str())));
+            ++argIndex;
         } else if (("-device_options" == currArg) && hasAtLeast2MoreArgs) {
             const auto deviceAcronyms = CompilerOptions::tokenize(args[argIndex + 1], ',');
             for (const auto &deviceAcronym : deviceAcronyms) {
@@ -394,22 +476,32 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         }
     }
     std::string optionsForIr;
-    for (const auto &product : targetProducts) {
-        int retVal = 0;
-        argsCopy[deviceArgIndex] = product.str();
-
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
-        if (OCLOC_SUCCESS != retVal) {
-            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
-            return retVal;
-        }
-
-        retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
+    if (concurrentBuilds > 1u && targetProducts.size() > 1u) {
+        auto retVal = buildFatBinaryForTargetsConcurrently(argsCopy, deviceArgIndex, targetProducts, concurrentBuilds, pointerSizeInBits, fatbinary, optionsForIr, argHelper);
         if (retVal) {
             return retVal;
         }
-        if (optionsForIr.empty()) {
-            optionsForIr = pCompiler->getOptions();
+    } else {
+        for (const auto &product : targetProducts) {
+            int retVal = 0;
+            argsCopy[deviceArgIndex] = product.str();
+
+            std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
+            if (OCLOC_SUCCESS != retVal) {
+                argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+                return retVal;
+            }
+            if (pCompiler->isVerbose()) {
+                argHelper->setVerbose(true);
+            }
+
+            retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
+            if (retVal) {
+                return retVal;
+            }
+            if (optionsForIr.empty()) {
+                optionsForIr = pCompiler->getOptions();
+            }
         }
     }
 
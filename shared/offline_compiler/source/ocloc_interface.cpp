@@ -139,6 +139,9 @@ int compile(OclocArgHelper *argHelper, const std::vector<std::string> &args) {
     std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, true, retVal, argHelper)};
 
     if (retVal == OCLOC_SUCCESS) {
+        if (pCompiler->isVerbose()) {
+            argHelper->setVerbose(true);
+        }
         if (pCompiler->showHelpOnly()) {
             return retVal;
         }
@@ -507,8 +507,10 @@ int OfflineCompiler::buildIrBinary() {
                                           internalOptions, ArrayRef<const char>(), ArrayRef<const char>(), igcRevision, igcLibSize, igcLibMTime);
         irBinary = cache->loadCachedBinary(irHash, irBinarySize).release();
         if (irBinary) {
+            cacheHits++;
             return retVal;
         }
+        cacheMisses++;
     }
 
     UNRECOVERABLE_IF(!fclFacade->isInitialized());
@@ -647,14 +649,17 @@ int OfflineCompiler::buildSourceCode() {
         if (genBinary) {
             bool isZebin = isDeviceBinaryFormat<DeviceBinaryFormat::zebin>(ArrayRef<uint8_t>(reinterpret_cast<uint8_t *>(genBinary), genBinarySize));
             if (!generateDebugInfo || isZebin) {
+                cacheHits++;
                 return retVal;
             }
             debugDataBinary = cache->loadCachedBinary(dbgHash, debugDataBinarySize).release();
             if (debugDataBinary) {
+                cacheHits++;
                 return retVal;
             }
         }
 
+        cacheMisses++;
         delete[] genBinary;
         genBinary = nullptr;
         genBinarySize = 0;
@@ -750,6 +755,10 @@ int OfflineCompiler::build() {
         writeOutAllFiles();
     }
 
+    if (allowCaching && verbose) {
+        argHelper->printf("Cache hits: %u, cache misses: %u\n", cacheHits, cacheMisses);
+    }
+
     return retVal;
 }
 
@@ -1056,7 +1065,7 @@ int OfflineCompiler::parseCommandLine(size_t numArgs, const std::vector<std::str
             argHelper->getPrinterRef().setSuppressMessages(true);
             quiet = true;
         } else if ("-v" == currArg) {
-            argHelper->setVerbose(true);
+            verbose = true;
         } else if ("-spv_only" == currArg) {
             onlySpirV = true;
         } else if ("-output_no_suffix" == currArg) {
@@ -1085,6 +1094,9 @@ int OfflineCompiler::parseCommandLine(size_t numArgs, const std::vector<std::str
             argIndex++;
         } else if ("-allow_caching" == currArg) {
             allowCaching = true;
+        } else if (("-j" == currArg) && hasMoreArgs) {
+            // concurrency of fat binary builds, handled by buildFatBinary
+            argIndex++;
         } else {
             argHelper->printf("Invalid option (arg %d): %s\n", argIndex, argv[argIndex].c_str());
             retVal = OCLOC_INVALID_COMMAND_LINE;
@@ -1316,6 +1328,7 @@ Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename
   -allow_caching                            Allows caching binaries from compilation (like spirv,
                                             gen or debug data) and loading them by ocloc
                                             when the same program is compiled again.
+                                            Cache hits and misses are printed in verbose mode.
 
   -cache_dir <output_dir>                   Optional caching directory.
                                             Default directory is "ocloc_cache".
@@ -1402,6 +1415,10 @@ Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename
 
   -exclude_ir                               Excludes IR from the output binary file.
 
+  -j <count>                                Number of targets built concurrently when
+                                            -device selects multiple targets (fat binary).
+                                            Build time of each target is reported.
+
   --format                                  Enforce given binary format. The possible values are:
                                             --format zebin - Enforce generating zebin binary
                                             --format patchtokens - Enforce generating patchtokens (legacy) binary.
@@ -1461,8 +1478,10 @@ bool OfflineCompiler::generateElfBinary() {
         auto loadedData = cache->loadCachedBinary(elfHash, elfBinarySize);
         elfBinary.assign(loadedData.get(), loadedData.get() + elfBinarySize);
         if (!elfBinary.empty()) {
+            cacheHits++;
             return true;
         }
+        cacheMisses++;
     }
 
     SingleDeviceBinary binary = {};
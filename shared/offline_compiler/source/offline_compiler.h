@@ -118,6 +118,10 @@ All supported acronyms: %s.
         return quiet;
     }
 
+    bool isVerbose() const {
+        return verbose;
+    }
+
     bool isOnlySpirV() const {
         return onlySpirV;
     }
@@ -211,6 +215,7 @@ All supported acronyms: %s.
     bool useGenFile = false;
     bool useOptionsSuffix = false;
     bool quiet = false;
+    bool verbose = false;
     bool onlySpirV = false;
     bool inputFileLlvm = false;
     bool inputFileSpirV = false;
@@ -232,6 +237,8 @@ All supported acronyms: %s.
     std::unique_ptr<buildInfo> pBuildInfo;
     int revisionId = -1;
     uint64_t hwInfoConfig = 0u;
+    uint32_t cacheHits = 0u;
+    uint32_t cacheMisses = 0u;
 
     std::unique_ptr<OclocIgcFacade> igcFacade;
     std::unique_ptr<OclocFclFacade> fclFacade;
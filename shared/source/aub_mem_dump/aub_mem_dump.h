@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,13 +8,18 @@
 #pragma once
 #include "shared/source/aub_mem_dump/aub_data.h"
 
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 namespace NEO {
 class AubHelper;
-}
+class Thread;
+} // namespace NEO
 
 namespace AubMemDump {
 #include "aub_services.h"
@@ -120,6 +125,7 @@ struct AubStream {
 };
 
 struct AubFileStream : public AubStream {
+    ~AubFileStream() override;
     void open(const char *filePath) override;
     void close() override;
     bool init(uint32_t stepping, uint32_t device) override;
@@ -143,6 +149,23 @@ struct AubFileStream : public AubStream {
     std::ofstream fileHandle;
     std::string fileName;
     std::mutex mutex;
+
+  protected:
+    static void *runAsyncWriter(void *self);
+    void startAsyncWriter(size_t bufferSize);
+    void stopAsyncWriter();
+    void submitAsyncBuffer();
+
+    static constexpr size_t maxPendingAsyncBuffers = 4u;
+
+    // With async writer enabled, writes are gathered in asyncBuffer and full buffers are written to file by background thread
+    std::unique_ptr<NEO::Thread> asyncWriter;
+    std::vector<char> asyncBuffer;
+    std::deque<std::vector<char>> pendingAsyncBuffers;
+    std::mutex asyncWriterMutex;
+    std::condition_variable asyncWriterCondition;
+    size_t asyncBufferSize = 0u;
+    bool asyncWriterStopRequested = false;
 };
 
 template <int addressingBits>
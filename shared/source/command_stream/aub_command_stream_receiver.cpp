@@ -12,11 +12,13 @@
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/options.h"
 #include "shared/source/os_interface/os_inc_base.h"
+#include "shared/source/os_interface/os_thread.h"
 #include "shared/source/os_interface/sys_calls_common.h"
 #include "shared/source/release_helper/release_helper.h"
 
@@ -95,24 +97,101 @@ static auto sizeMemoryWriteHeader = sizeof(CmdServicesMemTraceMemoryWrite) - siz
 
 extern const size_t dwordCountMax;
 
+AubFileStream::~AubFileStream() {
+    if (asyncWriter) {
+        stopAsyncWriter();
+    }
+}
+
 void AubFileStream::open(const char *filePath) {
     fileHandle.open(filePath, std::ofstream::binary);
     fileName.assign(filePath);
+
+    auto asyncWriterBufferSizeInKb = NEO::debugManager.flags.AubDumpAsyncWriterBufferSize.get();
+    if (asyncWriterBufferSizeInKb > 0 && fileHandle.is_open() && !asyncWriter) {
+        startAsyncWriter(static_cast<size_t>(asyncWriterBufferSizeInKb * MemoryConstants::kiloByte));
+    }
 }
 
 void AubFileStream::close() {
+    if (asyncWriter) {
+        stopAsyncWriter();
+    }
     fileHandle.close();
     fileName.clear();
 }
 
 void AubFileStream::write(const char *data, size_t size) {
+    if (asyncWriter) {
+        asyncBuffer.insert(asyncBuffer.end(), data, data + size);
+        if (asyncBuffer.size() >= asyncBufferSize) {
+            submitAsyncBuffer();
+        }
+        return;
+    }
     fileHandle.write(data, size);
 }
 
 void AubFileStream::flush() {
+    if (asyncWriter) {
+        submitAsyncBuffer();
+        return;
+    }
     fileHandle.flush();
 }
 
+void AubFileStream::startAsyncWriter(size_t bufferSize) {
+    asyncBufferSize = bufferSize;
+    asyncBuffer.reserve(asyncBufferSize);
+    asyncWriterStopRequested = false;
+    asyncWriter = NEO::Thread::create(runAsyncWriter, reinterpret_cast<void *>(this));
+}
+
+void AubFileStream::stopAsyncWriter() {
+    submitAsyncBuffer();
+    {
+        std::lock_guard<std::mutex> lock(asyncWriterMutex);
+        asyncWriterStopRequested = true;
+    }
+    asyncWriterCondition.notify_all();
+    asyncWriter->join();
+    asyncWriter.reset();
+    fileHandle.flush();
+}
+
+void AubFileStream::submitAsyncBuffer() {
+    if (asyncBuffer.empty()) {
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(asyncWriterMutex);
+        asyncWriterCondition.wait(lock, [this] { return pendingAsyncBuffers.size() < maxPendingAsyncBuffers; });
+        pendingAsyncBuffers.push_back(std::move(asyncBuffer));
+    }
+    asyncWriterCondition.notify_all();
+    asyncBuffer = {};
+    asyncBuffer.reserve(asyncBufferSize);
+}
+
+void *AubFileStream::runAsyncWriter(void *self) {
+    auto stream = reinterpret_cast<AubFileStream *>(self);
+    std::unique_lock<std::mutex> lock(stream->asyncWriterMutex);
+    while (true) {
+        stream->asyncWriterCondition.wait(lock, [stream] { return !stream->pendingAsyncBuffers.empty() || stream->asyncWriterStopRequested; });
+        if (stream->pendingAsyncBuffers.empty()) {
+            break;
+        }
+        auto buffer = std::move(stream->pendingAsyncBuffers.front());
+        stream->pendingAsyncBuffers.pop_front();
+        lock.unlock();
+        stream->fileHandle.write(buffer.data(), buffer.size());
+        stream->fileHandle.flush();
+        lock.lock();
+        stream->asyncWriterCondition.notify_all();
+    }
+    return nullptr;
+}
+
 bool AubFileStream::init(uint32_t stepping, uint32_t device) {
     CmdServicesMemTraceVersion header = {};
 
@@ -378,6 +378,7 @@ SubmissionStatus AUBCommandStreamReceiverHw<GfxFamily>::flush(BatchBuffer &batch
         batchBuffer.commandBufferAllocation = commandBufferAllocationBackup;
     }
 
+    this->printUploadStatistics();
     getAubStream()->flush();
     return SubmissionStatus::success;
 }
@@ -685,11 +686,19 @@ bool AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
 
     auto streamLocked = getAubStream()->lockStream();
 
-    if (aubManager) {
+    if (isChunkCopy) {
+        UNRECOVERABLE_IF(!aubManager);
         this->writeMemoryWithAubManager(gfxAllocation, isChunkCopy, gpuVaChunkOffset, chunkSize);
+        this->invalidateUploadedPages(gfxAllocation, gpuAddress, gpuVaChunkOffset, chunkSize);
     } else {
-        UNRECOVERABLE_IF(isChunkCopy);
-        writeMemory(gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
+        for (const auto &[chunkOffset, sizeToUpload] : this->getChunksToUpload(gfxAllocation, gpuAddress, cpuAddress, size)) {
+            const bool wholeAllocation = sizeToUpload == size;
+            if (aubManager) {
+                this->writeMemoryWithAubManager(gfxAllocation, !wholeAllocation, chunkOffset, wholeAllocation ? 0u : sizeToUpload);
+            } else {
+                writeMemory(gpuAddress + chunkOffset, ptrOffset(cpuAddress, chunkOffset), sizeToUpload, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
+            }
+        }
     }
 
     streamLocked.unlock();
@@ -125,6 +125,7 @@ CommandStreamReceiver::~CommandStreamReceiver() {
     internalAllocationStorage->cleanAllocationList(-1, REUSABLE_ALLOCATION);
     internalAllocationStorage->cleanAllocationList(-1, TEMPORARY_ALLOCATION);
     internalAllocationStorage->cleanAllocationList(-1, DEFERRED_DEALLOCATION);
+    internalAllocationStorage->cleanHostPtrImportCache();
     getMemoryManager()->unregisterEngineForCsr(this);
 }
 
@@ -902,6 +903,10 @@ bool CommandStreamReceiver::createAllocationForHostSurface(HostPtrSurface &surfa
     std::unique_lock<decltype(hostPtrSurfaceCreationMutex)> lock = this->obtainHostPtrSurfaceCreationLock();
     auto allocation = internalAllocationStorage->obtainTemporaryAllocationWithPtr(surface.getSurfaceSize(), surface.getMemoryPointer(), AllocationType::externalHostPtr);
 
+    if (allocation == nullptr) {
+        allocation = internalAllocationStorage->obtainHostPtrImportAllocation(surface.getSurfaceSize(), surface.getMemoryPointer());
+    }
+
     if (allocation == nullptr) {
         auto memoryManager = getMemoryManager();
         AllocationProperties properties{rootDeviceIndex,
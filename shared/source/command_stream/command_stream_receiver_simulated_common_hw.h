@@ -13,6 +13,10 @@
 #include "aub_mapper_common.h"
 #include "aubstream/hardware_context.h"
 
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace aub_stream {
 class AubManager;
 struct AubStream;
@@ -29,6 +33,9 @@ class CommandStreamReceiverSimulatedCommonHw : public CommandStreamReceiverHw<Gf
     using MiContextDescriptorReg = typename AUB::MiContextDescriptorReg;
 
     bool getParametersForMemory(GraphicsAllocation &graphicsAllocation, uint64_t &gpuAddress, void *&cpuAddress, size_t &size) const;
+    std::vector<std::pair<size_t, size_t>> getChunksToUpload(GraphicsAllocation &graphicsAllocation, uint64_t gpuAddress, const void *cpuAddress, size_t size);
+    void invalidateUploadedPages(GraphicsAllocation &graphicsAllocation, uint64_t gpuAddress, uint64_t offset, size_t size);
+    void printUploadStatistics();
     void freeEngineInfo(AddressMapper &gttRemap);
     MOCKABLE_VIRTUAL uint32_t getDeviceIndex() const;
 
@@ -91,5 +98,17 @@ class CommandStreamReceiverSimulatedCommonHw : public CommandStreamReceiverHw<Gf
     } engineInfo = {};
 
     AubMemDump::AubStream *stream;
+
+    struct UploadedPages {
+        uint64_t allocationId = 0u;
+        size_t size = 0u;
+        std::vector<uint64_t> hashes;
+        std::vector<bool> valid;
+    };
+    // Content hashes of pages uploaded per gpu address, used to upload only changed pages;
+    // an entry left by a freed allocation is reset when its address is reused by another allocation
+    std::unordered_map<uint64_t, UploadedPages> uploadedPages;
+    size_t uploadedBytes = 0u;
+    size_t skippedBytes = 0u;
 };
 } // namespace NEO
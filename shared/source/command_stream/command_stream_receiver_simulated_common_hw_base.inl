@@ -16,6 +16,7 @@
 #include "shared/source/gmm_helper/resource_info.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hardware_context_controller.h"
 #include "shared/source/memory_manager/address_mapper.h"
 #include "shared/source/memory_manager/memory_manager.h"
@@ -123,6 +124,68 @@ void CommandStreamReceiverSimulatedCommonHw<GfxFamily>::makeNonResident(Graphics
     }
 }
 
+template <typename GfxFamily>
+std::vector<std::pair<size_t, size_t>> CommandStreamReceiverSimulatedCommonHw<GfxFamily>::getChunksToUpload(GraphicsAllocation &graphicsAllocation, uint64_t gpuAddress, const void *cpuAddress, size_t size) {
+    std::vector<std::pair<size_t, size_t>> chunks;
+    if (!debugManager.flags.AubTbxUploadOnlyChangedPages.get() || AubHelper::isOneTimeAubWritableAllocationType(graphicsAllocation.getAllocationType())) {
+        chunks.emplace_back(0u, size);
+        uploadedBytes += size;
+        return chunks;
+    }
+
+    const auto pageCount = Math::divideAndRoundUp(size, MemoryConstants::pageSize);
+    auto &pages = uploadedPages[gpuAddress];
+    if (pages.allocationId != graphicsAllocation.getAllocationId() || pages.size != size) {
+        pages.allocationId = graphicsAllocation.getAllocationId();
+        pages.size = size;
+        pages.hashes.assign(pageCount, 0u);
+        pages.valid.assign(pageCount, false);
+    }
+
+    for (size_t page = 0; page < pageCount; page++) {
+        const auto offset = page * MemoryConstants::pageSize;
+        const auto pageSize = std::min(static_cast<size_t>(MemoryConstants::pageSize), size - offset);
+        const auto hash = Hash::hash(static_cast<const char *>(cpuAddress) + offset, pageSize);
+        if (pages.valid[page] && pages.hashes[page] == hash) {
+            skippedBytes += pageSize;
+            continue;
+        }
+        pages.hashes[page] = hash;
+        pages.valid[page] = true;
+        uploadedBytes += pageSize;
+
+        if (!chunks.empty() && chunks.back().first + chunks.back().second == offset) {
+            chunks.back().second += pageSize;
+        } else {
+            chunks.emplace_back(offset, pageSize);
+        }
+    }
+    return chunks;
+}
+
+template <typename GfxFamily>
+void CommandStreamReceiverSimulatedCommonHw<GfxFamily>::invalidateUploadedPages(GraphicsAllocation &graphicsAllocation, uint64_t gpuAddress, uint64_t offset, size_t size) {
+    auto it = uploadedPages.find(gpuAddress);
+    if (it == uploadedPages.end() || it->second.allocationId != graphicsAllocation.getAllocationId() || size == 0u) {
+        return;
+    }
+    auto &valid = it->second.valid;
+    const auto firstPage = static_cast<size_t>(offset / MemoryConstants::pageSize);
+    const auto lastPage = std::min(static_cast<size_t>((offset + size - 1) / MemoryConstants::pageSize), valid.size() - 1);
+    for (auto page = firstPage; page <= lastPage; page++) {
+        valid[page] = false;
+    }
+}
+
+template <typename GfxFamily>
+void CommandStreamReceiverSimulatedCommonHw<GfxFamily>::printUploadStatistics() {
+    if (debugManager.flags.AubTbxUploadOnlyChangedPages.get()) {
+        PRINT_DEBUG_STRING(debugManager.flags.PrintDebugMessages.get(), stdout, "Flush uploaded %zu bytes, skipped %zu bytes of unchanged pages\n", uploadedBytes, skippedBytes);
+    }
+    uploadedBytes = 0u;
+    skippedBytes = 0u;
+}
+
 template <typename GfxFamily>
 uint32_t CommandStreamReceiverSimulatedCommonHw<GfxFamily>::getDeviceIndex() const {
     return osContext->getDeviceBitfield().any() ? static_cast<uint32_t>(Math::log2(static_cast<uint32_t>(osContext->getDeviceBitfield().to_ulong()))) : 0u;
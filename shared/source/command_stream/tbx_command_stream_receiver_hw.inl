@@ -240,6 +240,7 @@ SubmissionStatus TbxCommandStreamReceiverHw<GfxFamily>::flush(BatchBuffer &batch
 
     // Write allocations for residency
     processResidency(allocationsForResidency, 0u);
+    this->printUploadStatistics();
 
     if (subCaptureManager) {
         if (aubManager) {
@@ -446,15 +447,22 @@ bool TbxCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
         return false;
     }
 
-    if (aubManager) {
-        this->writeMemoryWithAubManager(gfxAllocation, isChunkCopy, gpuVaChunkOffset, chunkSize);
+    if (isChunkCopy) {
+        if (aubManager) {
+            this->writeMemoryWithAubManager(gfxAllocation, isChunkCopy, gpuVaChunkOffset, chunkSize);
+        } else {
+            writeMemory(gpuAddress + gpuVaChunkOffset, ptrOffset(cpuAddress, static_cast<uintptr_t>(gpuVaChunkOffset)), chunkSize, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
+        }
+        this->invalidateUploadedPages(gfxAllocation, gpuAddress, gpuVaChunkOffset, chunkSize);
     } else {
-        if (isChunkCopy) {
-            gpuAddress += gpuVaChunkOffset;
-            cpuAddress = ptrOffset(cpuAddress, static_cast<uintptr_t>(gpuVaChunkOffset));
-            size = chunkSize;
+        for (const auto &[chunkOffset, sizeToUpload] : this->getChunksToUpload(gfxAllocation, gpuAddress, cpuAddress, size)) {
+            const bool wholeAllocation = sizeToUpload == size;
+            if (aubManager) {
+                this->writeMemoryWithAubManager(gfxAllocation, !wholeAllocation, chunkOffset, wholeAllocation ? 0u : sizeToUpload);
+            } else {
+                writeMemory(gpuAddress + chunkOffset, ptrOffset(cpuAddress, chunkOffset), sizeToUpload, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
+            }
         }
-        writeMemory(gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
     }
 
     if (AubHelper::isOneTimeAubWritableAllocationType(gfxAllocation.getAllocationType())) {
@@ -27,6 +27,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpFilterKernelEndIdx, -1, "End index of ker
 DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpToggleCaptureOnOff, 0, "Toggle AUB capture on/off")
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegister, 0, "Override mmio offset from list with new value from AubDumpOverrideMmioRegisterValue")
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegisterValue, 0, "Value to override mmio offset from AubDumpOverrideMmioRegister")
+DECLARE_DEBUG_VARIABLE(int32_t, AubDumpAsyncWriterBufferSize, -1, "Gather AUB file writes in memory and write them to file on background thread, applies when aubstream is not used. -1: default (disabled), 0: disabled, >0: size of buffer in KB")
 DECLARE_DEBUG_VARIABLE(int32_t, ClDeviceGlobalMemSizeAvailablePercent, -1, "Percent of total GPU memory available; CL_DEVICE_GLOBAL_MEM_SIZE")
 DECLARE_DEBUG_VARIABLE(int32_t, SetCommandStreamReceiver, -1, "Set command stream receiver to: 0 - HW, 1 - AUB, 2 - TBX, 3 - HW & AUB, 4 - TBX & AUB, 5 - NULL AUB")
 DECLARE_DEBUG_VARIABLE(int32_t, TbxPort, 4321, "TCP-IP port of TBX server")
@@ -40,6 +41,7 @@ DECLARE_DEBUG_VARIABLE(bool, AUBDumpAllocsOnEnqueueSVMMemcpyOnly, false, "Force
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpForceAllToLocalMemory, false, "Force placing every allocation in local memory address space")
 DECLARE_DEBUG_VARIABLE(bool, GenerateAubFilePerProcessId, true, "Generate aub file with process id")
 DECLARE_DEBUG_VARIABLE(bool, SetBufferHostMemoryAlwaysAubWritable, false, "Make buffer host memory allocation always uploaded to AUB/TBX")
+DECLARE_DEBUG_VARIABLE(bool, AubTbxUploadOnlyChangedPages, false, "Upload to AUB/TBX only pages of allocation which content changed since previous upload, memory written by GPU is not tracked. With PrintDebugMessages, uploaded and skipped bytes are printed on each flush")
 
 /*DEBUG FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableSWTags, false, "Enable software tagging in batch buffer")
@@ -97,6 +99,7 @@ DECLARE_DEBUG_VARIABLE(std::string, DumpSipHeaderFile, std::string("unk"), "Dump
 DECLARE_DEBUG_VARIABLE(std::string, InjectInternalBuildOptions, std::string("unk"), "Append provided string to internal build options for user modules; ignored when unk")
 DECLARE_DEBUG_VARIABLE(std::string, InjectApiBuildOptions, std::string("unk"), "Append provided string to api build options for user modules; ignored when unk")
 DECLARE_DEBUG_VARIABLE(std::string, OverrideDeviceName, std::string("unk"), "Override device name to provided string; ignored when unk")
+DECLARE_DEBUG_VARIABLE(std::string, ApiTraceFile, std::string("unk"), "Records timestamps, durations and return values of API calls to given file in Chrome trace event format; ignored when unk")
 DECLARE_DEBUG_VARIABLE(std::string, OverridePlatformName, std::string("unk"), "Override platform name to provided string; ignored when unk")
 DECLARE_DEBUG_VARIABLE(std::string, WddmResidencyLoggerOutputDirectory, std::string("unk"), "Selects non-default output directory for Wddm Residency logger file")
 DECLARE_DEBUG_VARIABLE(std::string, ToggleBitIn57GpuVa, std::string("unk"), "Toggles specific bit in GPU VA for given allocation type from heap extended. Format <allocation type 1>:<bit number 1>,<allocation type 2>:<bit number 2>")
@@ -314,6 +317,7 @@ DECLARE_DEBUG_VARIABLE(bool, LogAllocationType, false, "Logs allocation type to
 DECLARE_DEBUG_VARIABLE(bool, LogAllocationStdout, false, "Log allocations to stdout instead of file")
 DECLARE_DEBUG_VARIABLE(bool, LogMemoryObject, false, "Logs memory object ptrs, sizes and operations")
 DECLARE_DEBUG_VARIABLE(bool, LogWaitingForCompletion, false, "Logs waiting for completion")
+DECLARE_DEBUG_VARIABLE(int32_t, LogFileBufferSize, -1, "-1: default - each log file entry is written immediately, >0: size in KB of in-memory buffer for log file entries, entries are written when buffer is full and when logger is destroyed")
 DECLARE_DEBUG_VARIABLE(bool, ResidencyDebugEnable, false, "enables debug messages and checks for Residency Model")
 DECLARE_DEBUG_VARIABLE(bool, EventsDebugEnable, false, "enables debug messages for events, virtual events, blocked enqueues, events trees etc.")
 DECLARE_DEBUG_VARIABLE(bool, EventsTrackerEnable, false, "enables event graphs dumping")
@@ -396,6 +400,12 @@ DECLARE_DEBUG_VARIABLE(int32_t, UseLocalPreferredForCacheableBuffers, -1, "Use l
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCopyWithStagingBuffers, -1, "Enable copy with non-usm memory through staging buffers. -1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, StagingBufferSize, -1, "Size of single staging buffer. -1: default (2MB), >0: size in KB")
 DECLARE_DEBUG_VARIABLE(int32_t, ForcePostSyncL1Flush, -1, "-1: default (do nothing), 0: L1 flush disabled in post sync, 1: L1 flush enabled in post sync")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanPmtSnapshotValidityMs, -1, "-1: default (each telemetry key is read from device), >0: telemetry region is read once and keys are served from this snapshot for given number of milliseconds")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanFdCacheSize, -1, "-1: default (64), >0: maximal number of sysfs file descriptors kept open by Sysman file system access")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanEngineActivityPmuGroup, -1, "-1: default (disabled), 0: disabled, 1: enabled - open engine busyness counters of device as one perf event group and read them with single syscall")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanTelemetrySamplingIntervalMs, -1, "-1: default (disabled), >0: per device thread samples engine activity and energy counters with given interval in milliseconds, getters return latest sample")
+DECLARE_DEBUG_VARIABLE(int32_t, MetricsCalculationConcurrentSubDevices, -1, "-1: default (disabled), 0: disabled, 1: enabled - calculate metric values of each sub device set of multi device data on its own thread")
+DECLARE_DEBUG_VARIABLE(int32_t, IpSamplingDrainBufferSize, -1, "-1: default (streamer reads from kernel on zetMetricStreamerReadData), >0: size in KB of per sub-device ring, which background thread keeps filling from kernel, zetMetricStreamerReadData copies from this ring")
 DECLARE_DEBUG_VARIABLE(int32_t, AllowNotZeroForCompressedOnWddm, -1, "-1: default (do nothing), 0: do not set AllowNotZeroed for compressed resources, 1: set AllowNotZeroed for compressed resources");
 DECLARE_DEBUG_VARIABLE(int64_t, ForceGmmSystemMemoryBufferForAllocations, 0, "0: default, >0: (bitmask) for given Allocation Types, force GMM_RESOURCE_USAGE_OCL_SYSTEM_MEMORY_BUFFER gmm resource type");
 
@@ -557,6 +567,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalD2HCpuCopyThreshold, -1, "Override d
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLock, -1, "Experimentally copy memory through locked ptr. -1: default 0: disable 1: enable ")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalForceCopyThroughLock, -1, "Force copy through lock pointer on zeAppendMemoryCopy for all cases -1: default 0: disable 1: enable ")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSmallBufferPoolAllocator, -1, "Experimentally enable pool allocator for clCreateBuffer under 4KB.")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalMediumBufferPoolAllocator, -1, "Experimentally enable additional clCreateBuffer pool tier for buffers above small buffer threshold, up to 4MB. -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalHostPtrImportCacheSize, -1, "Experimentally keep completed imports of page aligned host pointers of at least 64KB alive for reuse by subsequent transfers. Cached imports are dropped on host pointer overlaps and when driver allocations covering them are freed, so only use when application does not unmap or remap host memory passed to transfers. -1: default (disabled), 0: disabled, >0: max size of cached imports per command stream receiver in MB")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLockWaitlistSizeThreshold, -1, "If less than given value, driver will wait for Waitlist on host, instead of sending appendBarrier. If 0, always use barrier.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableL0DebuggerForOpenCL, false, "Experimentally enable debugging OCL with L0 Debug API. When enabled - Level Zero debugging is disabled.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableTileAttach, true, "Experimentally enable attaching to tiles (subdevices).")
@@ -575,6 +587,7 @@ DECLARE_DEBUG_VARIABLE(bool, ForceDefaultThreadArbitrationPolicyIfNotSpecified,
 DECLARE_DEBUG_VARIABLE(bool, ForceAllResourcesUncached, false, "When set, all memory operations for all resources are forced to UC. This overrides all caching-related debug variables and globally disables all caches")
 DECLARE_DEBUG_VARIABLE(bool, EnableCpuCacheForResources, false, "When true, driver will set gmm flag cacheable related to caching on cpu, for resources where it is allowed")
 DECLARE_DEBUG_VARIABLE(bool, EnableDebuggerMmapMemoryAccess, false, "Mmap used to access memory by debug api, valid only on Linux OS")
+DECLARE_DEBUG_VARIABLE(bool, EnableDebuggerStateSaveAreaSnapshot, false, "Read whole context state save area in single transfer: once per stop event for register reads of stopped threads and once per stopped threads check")
 DECLARE_DEBUG_VARIABLE(bool, ForceDefaultGrfCompilationMode, false, "Adds build option -cl-intel-128-GRF-per-thread to force kernel compilation in Default-GRF mode")
 DECLARE_DEBUG_VARIABLE(bool, ForceLargeGrfCompilationMode, false, "Adds build option -cl-intel-256-GRF-per-thread to force kernel compilation in Large-GRF mode")
 DECLARE_DEBUG_VARIABLE(bool, EnableConcurrentSharedCrossP2PDeviceAccess, false, "Enables the concurrent use between host and peer devices of shared-allocations ")
@@ -18,6 +18,8 @@
 #include "shared/source/utilities/logger.h"
 
 namespace NEO {
+std::atomic<uint64_t> GraphicsAllocation::allocationIdCounter{0u};
+
 void GraphicsAllocation::setAllocationType(AllocationType allocationType) {
     if (this->allocationType != allocationType) {
         this->allocationType = allocationType;
@@ -101,6 +101,7 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
     void setGpuBaseAddress(uint64_t baseAddress) {
         gpuBaseAddress = baseAddress;
     }
+    uint64_t getAllocationId() const { return allocationId; }
     uint64_t getGpuAddress() const {
         DEBUG_BREAK_IF(gpuAddress < gpuBaseAddress);
         return gpuAddress + allocationOffset;
@@ -378,7 +379,10 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
 
     friend class SubmissionAggregator;
 
+    static std::atomic<uint64_t> allocationIdCounter;
+
     const uint32_t rootDeviceIndex;
+    const uint64_t allocationId = allocationIdCounter.fetch_add(1u) + 1u;
     AllocationInfo allocationInfo;
     AubInfo aubInfo;
     SharingInfo sharingInfo;
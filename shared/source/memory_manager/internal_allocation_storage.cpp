@@ -9,6 +9,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/memory_manager/host_ptr_manager.h"
 #include "shared/source/os_interface/os_context.h"
 
@@ -47,12 +48,18 @@ void InternalAllocationStorage::freeAllocationsList(TaskCountType waitTaskCount,
     auto lock = memoryManager->getHostPtrManager()->obtainOwnership();
 
     GraphicsAllocation *curr = allocationsList.detachNodes();
+    const auto hostPtrImportCacheMaxSize = (&allocationsList == &allocationLists[TEMPORARY_ALLOCATION]) ? getHostPtrImportCacheMaxSize() : 0u;
 
     IDList<GraphicsAllocation, false, true> allocationsLeft;
     while (curr != nullptr) {
         auto *next = curr->next;
         if (curr->hostPtrTaskCountAssignment == 0 && curr->getTaskCount(commandStreamReceiver.getOsContext().getContextId()) <= waitTaskCount) {
-            memoryManager->freeGraphicsMemory(curr);
+            if (isHostPtrImportCandidate(*curr, hostPtrImportCacheMaxSize)) {
+                hostPtrImportCacheSize += curr->getUnderlyingBufferSize();
+                hostPtrImportCache.pushTailOne(*curr);
+            } else {
+                memoryManager->freeGraphicsMemory(curr);
+            }
         } else {
             allocationsLeft.pushTailOne(*curr);
         }
@@ -62,6 +69,71 @@ void InternalAllocationStorage::freeAllocationsList(TaskCountType waitTaskCount,
     if (allocationsLeft.peekIsEmpty() == false) {
         allocationsList.splice(*allocationsLeft.detachNodes());
     }
+
+    if (hostPtrImportCacheMaxSize > 0u) {
+        trimHostPtrImportCache(hostPtrImportCacheMaxSize);
+    }
+}
+
+size_t InternalAllocationStorage::getHostPtrImportCacheMaxSize() const {
+    if (debugManager.flags.ExperimentalHostPtrImportCacheSize.get() <= 0) {
+        return 0u;
+    }
+    return static_cast<size_t>(debugManager.flags.ExperimentalHostPtrImportCacheSize.get()) * MemoryConstants::megaByte;
+}
+
+bool InternalAllocationStorage::isHostPtrImportCandidate(GraphicsAllocation &allocation, size_t maxCacheSize) const {
+    auto size = allocation.getUnderlyingBufferSize();
+    return allocation.getAllocationType() == AllocationType::externalHostPtr &&
+           size >= MemoryConstants::pageSize64k &&
+           size <= maxCacheSize &&
+           isAligned<MemoryConstants::pageSize>(allocation.getUnderlyingBuffer());
+}
+
+void InternalAllocationStorage::trimHostPtrImportCache(size_t maxCacheSize) {
+    auto memoryManager = commandStreamReceiver.getMemoryManager();
+    while (hostPtrImportCacheSize > maxCacheSize) {
+        auto allocation = hostPtrImportCache.removeFrontOne();
+        if (allocation == nullptr) {
+            break;
+        }
+        hostPtrImportCacheSize -= allocation->getUnderlyingBufferSize();
+        memoryManager->freeGraphicsMemory(allocation.release());
+    }
+}
+
+void InternalAllocationStorage::cleanHostPtrImportCache() {
+    auto lock = commandStreamReceiver.getMemoryManager()->getHostPtrManager()->obtainOwnership();
+    trimHostPtrImportCache(0u);
+}
+
+void InternalAllocationStorage::invalidateHostPtrImports(const void *ptr, size_t size) {
+    if (hostPtrImportCacheSize == 0u) {
+        return;
+    }
+    auto memoryManager = commandStreamReceiver.getMemoryManager();
+    auto lock = memoryManager->getHostPtrManager()->obtainOwnership();
+
+    const auto rangeStart = reinterpret_cast<uintptr_t>(ptr);
+    const auto rangeEnd = rangeStart + size;
+    GraphicsAllocation *curr = hostPtrImportCache.detachNodes();
+    IDList<GraphicsAllocation, false, true> allocationsLeft;
+    while (curr != nullptr) {
+        auto *next = curr->next;
+        const auto cachedStart = reinterpret_cast<uintptr_t>(curr->getUnderlyingBuffer());
+        const auto cachedEnd = cachedStart + curr->getUnderlyingBufferSize();
+        if (cachedStart < rangeEnd && rangeStart < cachedEnd) {
+            hostPtrImportCacheSize -= curr->getUnderlyingBufferSize();
+            memoryManager->freeGraphicsMemory(curr);
+        } else {
+            allocationsLeft.pushTailOne(*curr);
+        }
+        curr = next;
+    }
+
+    if (allocationsLeft.peekIsEmpty() == false) {
+        hostPtrImportCache.splice(*allocationsLeft.detachNodes());
+    }
 }
 
 std::unique_ptr<GraphicsAllocation> InternalAllocationStorage::obtainReusableAllocation(size_t requiredSize, AllocationType allocationType) {
@@ -74,6 +146,17 @@ std::unique_ptr<GraphicsAllocation> InternalAllocationStorage::obtainTemporaryAl
     return allocation;
 }
 
+std::unique_ptr<GraphicsAllocation> InternalAllocationStorage::obtainHostPtrImportAllocation(size_t requiredSize, const void *requiredPtr) {
+    if (hostPtrImportCache.peekIsEmpty()) {
+        return nullptr;
+    }
+    auto allocation = hostPtrImportCache.detachAllocation(requiredSize, requiredPtr, &commandStreamReceiver, AllocationType::externalHostPtr);
+    if (allocation != nullptr) {
+        hostPtrImportCacheSize -= allocation->getUnderlyingBufferSize();
+    }
+    return allocation;
+}
+
 DeviceBitfield InternalAllocationStorage::getDeviceBitfield() const {
     return commandStreamReceiver.getOsContext().getDeviceBitfield();
 }
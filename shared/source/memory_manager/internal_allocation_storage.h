@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 #include "shared/source/memory_manager/allocations_list.h"
 
 #include <array>
+#include <atomic>
 
 namespace NEO {
 
@@ -21,15 +22,27 @@ class InternalAllocationStorage {
     void storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation> &&gfxAllocation, uint32_t allocationUsage, TaskCountType taskCount);
     std::unique_ptr<GraphicsAllocation> obtainReusableAllocation(size_t requiredSize, AllocationType allocationType);
     std::unique_ptr<GraphicsAllocation> obtainTemporaryAllocationWithPtr(size_t requiredSize, const void *requiredPtr, AllocationType allocationType);
+    std::unique_ptr<GraphicsAllocation> obtainHostPtrImportAllocation(size_t requiredSize, const void *requiredPtr);
+    void cleanHostPtrImportCache();
+    void invalidateHostPtrImports(const void *ptr, size_t size);
     AllocationsList &getTemporaryAllocations() { return allocationLists[TEMPORARY_ALLOCATION]; }
     AllocationsList &getAllocationsForReuse() { return allocationLists[REUSABLE_ALLOCATION]; }
     AllocationsList &getDeferredAllocations() { return allocationLists[DEFERRED_DEALLOCATION]; }
+    AllocationsList &getHostPtrImportCache() { return hostPtrImportCache; }
+    size_t getHostPtrImportCacheSize() const { return hostPtrImportCacheSize; }
     DeviceBitfield getDeviceBitfield() const;
 
   protected:
     void freeAllocationsList(TaskCountType waitTaskCount, AllocationsList &allocationsList);
+    size_t getHostPtrImportCacheMaxSize() const;
+    bool isHostPtrImportCandidate(GraphicsAllocation &allocation, size_t maxCacheSize) const;
+    void trimHostPtrImportCache(size_t maxCacheSize);
     CommandStreamReceiver &commandStreamReceiver;
 
     std::array<AllocationsList, 3> allocationLists = {AllocationsList(TEMPORARY_ALLOCATION), AllocationsList(REUSABLE_ALLOCATION), AllocationsList(DEFERRED_DEALLOCATION)};
+
+    // Completed user pointer imports kept alive for reuse by subsequent transfers, least recently used at head.
+    AllocationsList hostPtrImportCache{TEMPORARY_ALLOCATION};
+    std::atomic<size_t> hostPtrImportCacheSize{0u};
 };
 } // namespace NEO
@@ -284,6 +284,17 @@ void MemoryManager::freeGraphicsMemory(GraphicsAllocation *gfxAllocation, bool i
     }
     DBG_LOG(ResidencyDebugEnable, "Residency:", __FUNCTION__, "Free allocation, gpu address = ", std::hex, gfxAllocation->getGpuAddress());
 
+    // host range of a driver owned allocation may be reused by the application once it is freed
+    if (debugManager.flags.ExperimentalHostPtrImportCacheSize.get() > 0 &&
+        gfxAllocation->getAllocationType() != AllocationType::externalHostPtr &&
+        gfxAllocation->getUnderlyingBuffer() != nullptr) {
+        for (auto &engineContainer : allRegisteredEngines) {
+            for (auto &engine : engineContainer) {
+                engine.commandStreamReceiver->getInternalAllocationStorage()->invalidateHostPtrImports(gfxAllocation->getUnderlyingBuffer(), gfxAllocation->getUnderlyingBufferSize());
+            }
+        }
+    }
+
     getLocalMemoryUsageBankSelector(gfxAllocation->getAllocationType(), gfxAllocation->getRootDeviceIndex())->freeOnBanks(gfxAllocation->storageInfo.getMemoryBanks(), gfxAllocation->getUnderlyingBufferSize());
     freeGraphicsMemoryImpl(gfxAllocation, isImportedAllocation);
 }
@@ -925,6 +936,7 @@ void MemoryManager::cleanTemporaryAllocationListOnAllEngines(bool waitForComplet
                 csr->waitForCompletionWithTimeout(WaitParams{false, false, 0}, csr->peekLatestSentTaskCount());
             }
             csr->getInternalAllocationStorage()->cleanAllocationList(*csr->getTagAddress(), AllocationUsage::TEMPORARY_ALLOCATION);
+            csr->getInternalAllocationStorage()->cleanHostPtrImportCache();
         }
     }
 }
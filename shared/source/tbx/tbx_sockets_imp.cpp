@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -18,14 +18,17 @@ typedef int socklen_t;
 #else
 #include <arpa/inet.h>
 #include <netdb.h>
+#include <netinet/tcp.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/uio.h>
 #include <unistd.h>
 typedef struct sockaddr SOCKADDR;
 #define INVALID_SOCKET -1
 #endif
 #include "tbx_proto.h"
 
+#include <algorithm>
 #include <cstdint>
 
 namespace NEO {
@@ -36,6 +39,7 @@ TbxSocketsImp::TbxSocketsImp(std::ostream &err)
 
 void TbxSocketsImp::close() {
     if (0 != socket) {
+        flushPendingWrites();
 #ifdef WIN32
         ::shutdown(socket, 0x02 /*SD_BOTH*/);
 
@@ -79,6 +83,10 @@ bool TbxSocketsImp::init(const std::string &hostNameOrIp, uint16_t port) {
             break;
         }
 
+        // requests are batched by the client, so Nagle's algorithm would only delay them
+        int noDelay = 1;
+        ::setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char *>(&noDelay), sizeof(noDelay));
+
         HasMsg cmd;
         memset(&cmd, 0, sizeof(cmd));
         cmd.hdr.msgType = HAS_CONTROL_REQ_TYPE;
@@ -242,12 +250,12 @@ bool TbxSocketsImp::writeMemory(uint64_t physAddr, const void *data, size_t size
 
     bool success;
     do {
-        success = sendWriteData(&cmd, sizeof(HasHdr) + sizeof(HasWriteDataReq));
+        success = queueWriteData(&cmd, sizeof(HasHdr) + sizeof(HasWriteDataReq));
         if (!success) {
             break;
         }
 
-        success = sendWriteData(data, size);
+        success = queueWriteData(data, size);
         if (!success) {
             cerrStream << "Problem sending write data?" << std::endl;
             break;
@@ -269,24 +277,78 @@ bool TbxSocketsImp::writeGTT(uint32_t offset, uint64_t entry) {
     cmd.u.gtt64Req.data = static_cast<uint32_t>(entry & 0xffffffff);
     cmd.u.gtt64Req.dataH = static_cast<uint32_t>(entry >> 32);
 
-    return sendWriteData(&cmd, sizeof(HasHdr) + cmd.hdr.size);
+    return queueWriteData(&cmd, sizeof(HasHdr) + cmd.hdr.size);
 }
 
-bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
-    size_t totalSent = 0;
+bool TbxSocketsImp::queueWriteData(const void *buffer, size_t sizeInBytes) {
+    if (pendingWrites.size() + sizeInBytes > pendingWritesCapacity) {
+        return sendWriteData(buffer, sizeInBytes);
+    }
+
     auto dataBuffer = reinterpret_cast<const char *>(buffer);
+    pendingWrites.insert(pendingWrites.end(), dataBuffer, dataBuffer + sizeInBytes);
+    return true;
+}
 
-    do {
-        auto bytesSent = ::send(socket, &dataBuffer[totalSent], static_cast<int>(sizeInBytes - totalSent), 0);
-        if (bytesSent == 0 || bytesSent == static_cast<int>(INVALID_SOCKET)) {
+bool TbxSocketsImp::flushPendingWrites() {
+    if (pendingWrites.empty()) {
+        return true;
+    }
+    return sendWriteData(nullptr, 0u);
+}
+
+bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
+    const char *dataBuffers[maxSendBuffers] = {pendingWrites.data(), reinterpret_cast<const char *>(buffer)};
+    size_t remainingSizes[maxSendBuffers] = {pendingWrites.size(), sizeInBytes};
+    bool success = true;
+
+    while (remainingSizes[0] + remainingSizes[1] > 0) {
+        auto bytesSent = sendBuffers(dataBuffers, remainingSizes, maxSendBuffers);
+        if (bytesSent <= 0) {
             logErrorInfo("Connection Closed.");
-            return false;
+            success = false;
+            break;
         }
 
-        totalSent += bytesSent;
-    } while (totalSent < sizeInBytes);
+        auto bytesLeft = static_cast<size_t>(bytesSent);
+        for (auto i = 0u; i < maxSendBuffers; i++) {
+            auto bytesConsumed = std::min(bytesLeft, remainingSizes[i]);
+            dataBuffers[i] += bytesConsumed;
+            remainingSizes[i] -= bytesConsumed;
+            bytesLeft -= bytesConsumed;
+        }
+    }
 
-    return true;
+    pendingWrites.clear();
+    return success;
+}
+
+int64_t TbxSocketsImp::sendBuffers(const char *const *buffers, const size_t *sizes, uint32_t count) {
+    UNRECOVERABLE_IF(count > maxSendBuffers);
+#ifdef WIN32
+    WSABUF wsaBuffers[maxSendBuffers];
+    for (auto i = 0u; i < count; i++) {
+        wsaBuffers[i].buf = const_cast<char *>(buffers[i]);
+        wsaBuffers[i].len = static_cast<ULONG>(sizes[i]);
+    }
+
+    DWORD bytesSent = 0;
+    if (::WSASend(socket, wsaBuffers, count, &bytesSent, 0, nullptr, nullptr) == SOCKET_ERROR) {
+        return -1;
+    }
+    return static_cast<int64_t>(bytesSent);
+#else
+    iovec ioVectors[maxSendBuffers];
+    for (auto i = 0u; i < count; i++) {
+        ioVectors[i].iov_base = const_cast<char *>(buffers[i]);
+        ioVectors[i].iov_len = sizes[i];
+    }
+
+    msghdr message = {};
+    message.msg_iov = ioVectors;
+    message.msg_iovlen = count;
+    return static_cast<int64_t>(::sendmsg(socket, &message, 0));
+#endif
 }
 
 bool TbxSocketsImp::getResponseData(void *buffer, size_t sizeInBytes) {
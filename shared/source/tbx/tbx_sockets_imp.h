@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 
 #include <cstdint>
 #include <iostream>
+#include <vector>
 
 namespace NEO {
 
@@ -35,8 +36,16 @@ class TbxSocketsImp : public TbxSockets {
     std::ostream &cerrStream;
     SOCKET socket = 0;
 
+    // Posted writes (memory, GTT) which do not expect a response are coalesced in pendingWrites.
+    // Any other request sends pending data first, so the order of transactions is preserved.
+    static constexpr size_t pendingWritesCapacity = 64 * 1024;
+    static constexpr uint32_t maxSendBuffers = 2;
+
     bool connectToServer(const std::string &hostNameOrIp, uint16_t port);
+    bool queueWriteData(const void *buffer, size_t sizeInBytes);
+    bool flushPendingWrites();
     bool sendWriteData(const void *buffer, size_t sizeInBytes);
+    MOCKABLE_VIRTUAL int64_t sendBuffers(const char *const *buffers, const size_t *sizes, uint32_t count);
     bool getResponseData(void *buffer, size_t sizeInBytes);
 
     inline uint32_t getNextTransID() { return transID++; }
@@ -44,5 +53,6 @@ class TbxSocketsImp : public TbxSockets {
     void logErrorInfo(const char *tag);
 
     uint32_t transID = 0;
+    std::vector<char> pendingWrites;
 };
 } // namespace NEO
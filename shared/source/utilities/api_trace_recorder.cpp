@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/api_trace_recorder.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/sys_calls_common.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+namespace NEO {
+
+std::atomic<uint64_t> ApiTraceRecorder::recorderIdCounter{0u};
+
+static void finishApiTrace() {
+    apiTraceRecorderInstance()->finish();
+}
+
+ApiTraceRecorder *apiTraceRecorderInstance() {
+    // Intentionally leaked, API calls from other threads, static destructors or exit handlers may still use it
+    static ApiTraceRecorder *apiTraceRecorder = []() {
+        auto recorder = ApiTraceRecorder::create(debugManager.flags.ApiTraceFile.get()).release();
+        if (recorder) {
+            std::atexit(finishApiTrace);
+        }
+        return recorder;
+    }();
+    return apiTraceRecorder;
+}
+
+std::unique_ptr<ApiTraceRecorder> ApiTraceRecorder::create(const std::string &traceFileName) {
+    if (traceFileName == "unk") {
+        return nullptr;
+    }
+
+    auto traceFile = std::make_unique<std::ofstream>(traceFileName, std::ios::trunc);
+    if (!traceFile->is_open()) {
+        return nullptr;
+    }
+    return std::make_unique<ApiTraceRecorder>(std::move(traceFile), SysCalls::getProcessId());
+}
+
+ApiTraceRecorder::ApiTraceRecorder(std::unique_ptr<std::ostream> &&traceOut, uint32_t processId)
+    : recorderId(recorderIdCounter.fetch_add(1u) + 1u), processId(processId), startTime(std::chrono::steady_clock::now()), traceOut(std::move(traceOut)) {
+    *this->traceOut << "[\n";
+}
+
+ApiTraceRecorder::~ApiTraceRecorder() {
+    finish();
+}
+
+void ApiTraceRecorder::finish() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (finished) {
+        return;
+    }
+    writePendingEvents();
+    *traceOut << "\n]\n";
+    traceOut->flush();
+    finished = true;
+}
+
+void ApiTraceRecorder::record(const char *name, int64_t start, int32_t returnValue) {
+    if (finished) {
+        return;
+    }
+    auto end = getTimestamp();
+    auto &threadEvents = getThreadEvents();
+
+    std::vector<Event> chunk;
+    {
+        std::lock_guard<std::mutex> threadLock(threadEvents.mutex);
+        threadEvents.events.push_back({name, start, end - start, returnValue});
+        if (threadEvents.events.size() < eventsPerChunk) {
+            return;
+        }
+        chunk.reserve(eventsPerChunk);
+        chunk.swap(threadEvents.events);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!finished) {
+        writeEvents(threadEvents.threadIndex, chunk);
+    }
+}
+
+ApiTraceRecorder::ThreadEvents &ApiTraceRecorder::getThreadEvents() {
+    thread_local uint64_t cachedRecorderId = 0u;
+    thread_local ThreadEvents *cachedThreadEvents = nullptr;
+
+    if (cachedRecorderId != recorderId) {
+        auto threadEvents = std::make_unique<ThreadEvents>();
+        threadEvents->events.reserve(eventsPerChunk);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        threadEvents->threadIndex = static_cast<uint32_t>(threadEventsList.size()) + 1u;
+        cachedThreadEvents = threadEvents.get();
+        cachedRecorderId = recorderId;
+        threadEventsList.push_back(std::move(threadEvents));
+    }
+    return *cachedThreadEvents;
+}
+
+void ApiTraceRecorder::writeEvents(uint32_t threadIndex, const std::vector<Event> &events) {
+    char line[512];
+    for (const auto &event : events) {
+        auto length = snprintf(line, sizeof(line),
+                               "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%u,\"tid\":%u,\"ts\":%" PRId64 ".%03" PRId64 ",\"dur\":%" PRId64 ".%03" PRId64 ",\"args\":{\"ret\":%d}}",
+                               eventWritten ? ",\n" : "", event.name, processId, threadIndex,
+                               event.start / 1000, event.start % 1000, event.duration / 1000, event.duration % 1000, event.returnValue);
+        if (length > 0) {
+            traceOut->write(line, std::min(static_cast<size_t>(length), sizeof(line) - 1));
+        }
+        eventWritten = true;
+    }
+}
+
+void ApiTraceRecorder::writePendingEvents() {
+    // Called with mutex held, lock of each thread is taken only to take over its events
+    for (auto &threadEvents : threadEventsList) {
+        std::vector<Event> events;
+        {
+            std::lock_guard<std::mutex> threadLock(threadEvents->mutex);
+            events.swap(threadEvents->events);
+        }
+        writeEvents(threadEvents->threadIndex, events);
+    }
+}
+
+} // namespace NEO
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace NEO {
+
+// Records API enter timestamps and durations into per-thread chunks, each guarded by its own lock.
+// A chunk is written in Chrome trace event format (JSON array) once it fills up,
+// remaining events are written when the trace is finished. Events recorded after that are dropped.
+class ApiTraceRecorder {
+  public:
+    struct Event {
+        const char *name;
+        int64_t start;
+        int64_t duration;
+        int32_t returnValue;
+    };
+
+    static constexpr size_t eventsPerChunk = 4096;
+
+    static std::unique_ptr<ApiTraceRecorder> create(const std::string &traceFileName);
+
+    ApiTraceRecorder(std::unique_ptr<std::ostream> &&traceOut, uint32_t processId);
+    ~ApiTraceRecorder();
+
+    ApiTraceRecorder(const ApiTraceRecorder &) = delete;
+    ApiTraceRecorder &operator=(const ApiTraceRecorder &) = delete;
+
+    int64_t getTimestamp() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+    }
+
+    void record(const char *name, int64_t start, int32_t returnValue);
+    void finish();
+
+  protected:
+    struct ThreadEvents {
+        uint32_t threadIndex = 0u;
+        std::mutex mutex;
+        std::vector<Event> events;
+    };
+
+    ThreadEvents &getThreadEvents();
+    void writeEvents(uint32_t threadIndex, const std::vector<Event> &events);
+    void writePendingEvents();
+
+    static std::atomic<uint64_t> recorderIdCounter;
+
+    const uint64_t recorderId;
+    const uint32_t processId;
+    const std::chrono::steady_clock::time_point startTime;
+    std::unique_ptr<std::ostream> traceOut;
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadEvents>> threadEventsList;
+    bool eventWritten = false;
+    std::atomic<bool> finished{false};
+};
+
+ApiTraceRecorder *apiTraceRecorderInstance();
+
+class ApiTraceScope {
+  public:
+    ApiTraceScope(const char *name, const int *returnValue)
+        : name(name), returnValue(returnValue), recorder(apiTraceRecorderInstance()) {
+        if (recorder) {
+            start = recorder->getTimestamp();
+        }
+    }
+
+    ~ApiTraceScope() {
+        if (recorder) {
+            recorder->record(name, start, (returnValue != nullptr) ? *returnValue : 0);
+        }
+    }
+
+    ApiTraceScope(const ApiTraceScope &) = delete;
+    ApiTraceScope &operator=(const ApiTraceScope &) = delete;
+
+  protected:
+    const char *name;
+    const int *returnValue;
+    ApiTraceRecorder *recorder;
+    int64_t start = 0;
+};
+
+} // namespace NEO
@@ -87,6 +87,7 @@ class AbstractBuffersAllocator : public SmallBuffersParams<BuffersPoolType> {
 
   protected:
     inline bool isSizeWithinThreshold(size_t size) const { return smallBufferThreshold >= size; }
+    bool isPoolBuffer(const BufferParentType *buffer, const std::vector<BuffersPoolType> &bufferPoolsVec) const;
     void tryFreeFromPoolBuffer(BufferParentType *possiblePoolBuffer, size_t offset, size_t size, std::vector<BuffersPoolType> &bufferPoolsVec);
     void drain();
     void drain(std::vector<BuffersPoolType> &bufferPoolsVec);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@ AbstractBuffersPool<PoolT, BufferType, BufferParentType>::AbstractBuffersPool(Ab
     : memoryManager{bufferPool.memoryManager},
       mainStorage{std::move(bufferPool.mainStorage)},
       chunkAllocator{std::move(bufferPool.chunkAllocator)},
+      chunksToFree{std::move(bufferPool.chunksToFree)},
       onChunkFreeCallback{bufferPool.onChunkFreeCallback} {}
 
 template <typename PoolT, typename BufferType, typename BufferParentType>
@@ -59,9 +60,14 @@ void AbstractBuffersPool<PoolT, BufferType, BufferParentType>::drain() {
 
 template <typename BuffersPoolType, typename BufferType, typename BufferParentType>
 bool AbstractBuffersAllocator<BuffersPoolType, BufferType, BufferParentType>::isPoolBuffer(const BufferParentType *buffer) const {
+    return this->isPoolBuffer(buffer, this->bufferPools);
+}
+
+template <typename BuffersPoolType, typename BufferType, typename BufferParentType>
+bool AbstractBuffersAllocator<BuffersPoolType, BufferType, BufferParentType>::isPoolBuffer(const BufferParentType *buffer, const std::vector<BuffersPoolType> &bufferPoolsVec) const {
     static_assert(std::is_base_of_v<BufferParentType, BufferType>);
 
-    for (auto &bufferPool : this->bufferPools) {
+    for (auto &bufferPool : bufferPoolsVec) {
         if (bufferPool.isPoolBuffer(buffer)) {
             return true;
         }
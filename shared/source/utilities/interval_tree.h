@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <set>
+
+namespace NEO {
+
+// Address intervals kept in a balanced tree ordered by start, together with lengths of all intervals.
+// Only intervals starting within max length before a queried range can intersect it, so intersection
+// queries are O(log n + k), and insertion and removal are O(log n).
+template <typename ValueType>
+class IntervalTree {
+  public:
+    struct Interval {
+        uintptr_t start;
+        uintptr_t end;
+        ValueType value;
+    };
+
+    void insert(const void *ptr, size_t length, const ValueType &value) {
+        const auto start = reinterpret_cast<uintptr_t>(ptr);
+        intervals.emplace(start, Interval{start, start + length, value});
+        lengths.insert(length);
+    }
+
+    ValueType *find(const void *ptr) {
+        auto it = findByStart(ptr, [](const ValueType &) { return true; });
+        return it != intervals.end() ? &it->second.value : nullptr;
+    }
+
+    bool remove(const void *ptr) {
+        return remove(ptr, [](const ValueType &) { return true; });
+    }
+
+    template <typename PredicateT>
+    bool remove(const void *ptr, PredicateT &&predicate) {
+        auto it = findByStart(ptr, predicate);
+        if (it == intervals.end()) {
+            return false;
+        }
+        erase(it);
+        return true;
+    }
+
+    template <typename PredicateT>
+    size_t removeAll(PredicateT &&predicate) {
+        size_t removedCount = 0u;
+        for (auto it = intervals.begin(); it != intervals.end();) {
+            if (predicate(it->second.value)) {
+                it = erase(it);
+                removedCount++;
+            } else {
+                it++;
+            }
+        }
+        return removedCount;
+    }
+
+    // Returns first interval (in start order) with end >= minEnd and start <= maxStart, which satisfies predicate.
+    template <typename PredicateT>
+    const Interval *findIntersecting(uintptr_t minEnd, uintptr_t maxStart, PredicateT &&predicate) const {
+        if (intervals.empty()) {
+            return nullptr;
+        }
+        const auto maxLength = *lengths.rbegin();
+        const auto minStart = minEnd > maxLength ? minEnd - maxLength : 0u;
+        for (auto it = intervals.lower_bound(minStart); it != intervals.end() && it->first <= maxStart; it++) {
+            const auto &interval = it->second;
+            if (interval.end >= minEnd && predicate(interval)) {
+                return &interval;
+            }
+        }
+        return nullptr;
+    }
+
+    size_t size() const {
+        return intervals.size();
+    }
+
+  protected:
+    using IntervalsMap = std::multimap<uintptr_t, Interval>;
+
+    template <typename PredicateT>
+    typename IntervalsMap::iterator findByStart(const void *ptr, PredicateT &&predicate) {
+        const auto range = intervals.equal_range(reinterpret_cast<uintptr_t>(ptr));
+        for (auto it = range.first; it != range.second; it++) {
+            if (predicate(it->second.value)) {
+                return it;
+            }
+        }
+        return intervals.end();
+    }
+
+    typename IntervalsMap::iterator erase(typename IntervalsMap::iterator it) {
+        lengths.erase(lengths.find(it->second.end - it->second.start));
+        return intervals.erase(it);
+    }
+
+    IntervalsMap intervals;
+    std::multiset<size_t> lengths;
+};
+
+} // namespace NEO
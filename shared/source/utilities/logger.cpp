@@ -8,6 +8,7 @@
 #include "shared/source/utilities/logger.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/utilities/io_functions.h"
 
@@ -34,14 +35,32 @@ FileLogger<debugLevel>::FileLogger(std::string filename, const DebugVariables &f
     logAllocationMemoryPool = flags.LogAllocationMemoryPool.get();
     logAllocationType = flags.LogAllocationType.get();
     logAllocationStdout = flags.LogAllocationStdout.get();
+    if (flags.LogFileBufferSize.get() > 0) {
+        logFileBufferSize = static_cast<size_t>(flags.LogFileBufferSize.get()) * MemoryConstants::kiloByte;
+    }
 }
 
 template <DebugFunctionalityLevel debugLevel>
-FileLogger<debugLevel>::~FileLogger() = default;
+FileLogger<debugLevel>::~FileLogger() {
+    closeLogFile();
+}
 
 template <DebugFunctionalityLevel debugLevel>
 void FileLogger<debugLevel>::writeToFile(std::string filename, const char *str, size_t length, std::ios_base::openmode mode) {
+    if (mode == std::ios::app && filename == logFileName) {
+        appendToLogFile(str, length);
+        return;
+    }
+
     std::lock_guard theLock(mutex);
+    {
+        // Log file kept open under the same name is flushed and closed before it is written here
+        std::lock_guard fileLock(logFileMutex);
+        if (filename == openedLogFileName) {
+            flushAndCloseLogFile();
+        }
+    }
+
     std::ofstream outFile(filename, mode);
     if (outFile.is_open()) {
         outFile.write(str, length);
@@ -49,6 +68,65 @@ void FileLogger<debugLevel>::writeToFile(std::string filename, const char *str,
     }
 }
 
+// Log file is kept open between entries. With buffering enabled, entries are gathered in memory
+// and the thread which fills the buffer writes it out, while other threads keep appending.
+template <DebugFunctionalityLevel debugLevel>
+void FileLogger<debugLevel>::appendToLogFile(const char *str, size_t length) {
+    std::unique_lock bufferLock(mutex);
+    if (logFileBufferSize == 0u) {
+        std::lock_guard fileLock(logFileMutex);
+        bufferLock.unlock();
+        writeToLogFile(str, length);
+        return;
+    }
+
+    logFileBuffer.insert(logFileBuffer.end(), str, str + length);
+    if (logFileBuffer.size() < logFileBufferSize) {
+        return;
+    }
+
+    std::vector<char> bufferToWrite;
+    bufferToWrite.reserve(logFileBufferSize);
+    bufferToWrite.swap(logFileBuffer);
+
+    std::lock_guard fileLock(logFileMutex);
+    bufferLock.unlock();
+    writeToLogFile(bufferToWrite.data(), bufferToWrite.size());
+}
+
+template <DebugFunctionalityLevel debugLevel>
+void FileLogger<debugLevel>::writeToLogFile(const char *str, size_t length) {
+    if (!logFile.is_open() || openedLogFileName != logFileName) {
+        logFile.close();
+        logFile.clear();
+        logFile.open(logFileName, std::ios::app);
+        openedLogFileName = logFileName;
+    }
+
+    if (logFile.is_open()) {
+        logFile.write(str, length);
+        logFile.flush();
+    }
+}
+
+template <DebugFunctionalityLevel debugLevel>
+void FileLogger<debugLevel>::closeLogFile() {
+    std::lock_guard bufferLock(mutex);
+    std::lock_guard fileLock(logFileMutex);
+    flushAndCloseLogFile();
+}
+
+// Called with both mutex and logFileMutex held
+template <DebugFunctionalityLevel debugLevel>
+void FileLogger<debugLevel>::flushAndCloseLogFile() {
+    if (!logFileBuffer.empty()) {
+        writeToLogFile(logFileBuffer.data(), logFileBuffer.size());
+        logFileBuffer.clear();
+    }
+    logFile.close();
+    openedLogFileName.clear();
+}
+
 template <DebugFunctionalityLevel debugLevel>
 void FileLogger<debugLevel>::logDebugString(bool enableLog, std::string_view debugString) {
     if (enabled()) {
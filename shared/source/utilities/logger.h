@@ -8,9 +8,11 @@
 #pragma once
 #include "shared/source/debug_settings/debug_settings_manager.h"
 
+#include <fstream>
 #include <mutex>
 #include <sstream>
 #include <thread>
+#include <vector>
 
 namespace NEO {
 class Kernel;
@@ -140,8 +142,18 @@ class FileLogger {
     bool peekLogApiCalls() { return logApiCalls; }
 
   protected:
+    void appendToLogFile(const char *str, size_t length);
+    void writeToLogFile(const char *str, size_t length);
+    void closeLogFile();
+    void flushAndCloseLogFile();
+
     std::mutex mutex;
+    std::mutex logFileMutex;
     std::string logFileName;
+    std::string openedLogFileName;
+    std::ofstream logFile;
+    std::vector<char> logFileBuffer;
+    size_t logFileBufferSize = 0u;
     bool dumpKernels = false;
     bool logApiCalls = false;
     bool logAllocationMemoryPool = false;
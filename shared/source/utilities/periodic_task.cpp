@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/periodic_task.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+namespace NEO {
+
+PeriodicTask::PeriodicTask(std::function<void()> task, std::chrono::microseconds period) : task(std::move(task)), period(period) {}
+
+PeriodicTask::~PeriodicTask() {
+    stop();
+}
+
+void *PeriodicTask::threadFunction(void *arg) {
+    auto periodicTask = reinterpret_cast<PeriodicTask *>(arg);
+    std::unique_lock<std::mutex> lock(periodicTask->stopMutex);
+    while (!periodicTask->stopRequested) {
+        lock.unlock();
+        periodicTask->task();
+        lock.lock();
+        periodicTask->stopCondition.wait_for(lock, periodicTask->period, [periodicTask] { return periodicTask->stopRequested; });
+    }
+    return nullptr;
+}
+
+void PeriodicTask::start() {
+    if (thread) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(stopMutex);
+        stopRequested = false;
+    }
+    thread = Thread::create(threadFunction, reinterpret_cast<void *>(this));
+}
+
+void PeriodicTask::stop() {
+    if (!thread) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(stopMutex);
+        stopRequested = true;
+    }
+    stopCondition.notify_all();
+    thread->join();
+    thread.reset();
+}
+
+} // namespace NEO
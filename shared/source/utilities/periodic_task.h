@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace NEO {
+class Thread;
+
+// Background thread calling task once per period until stopped. Stop request wakes the thread
+// immediately instead of waiting for the rest of current period.
+class PeriodicTask : NonCopyableOrMovableClass {
+  public:
+    PeriodicTask(std::function<void()> task, std::chrono::microseconds period);
+    ~PeriodicTask();
+
+    void start();
+    void stop();
+    bool isRunning() const { return thread != nullptr; }
+
+  protected:
+    static void *threadFunction(void *arg);
+
+    std::function<void()> task;
+    const std::chrono::microseconds period;
+
+    std::unique_ptr<Thread> thread;
+    std::mutex stopMutex;
+    std::condition_variable stopCondition;
+    bool stopRequested = false;
+};
+
+} // namespace NEO
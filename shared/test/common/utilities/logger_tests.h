@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -18,8 +18,11 @@ template <DebugFunctionalityLevel debugLevel>
 class TestFileLogger : public NEO::FileLogger<debugLevel> {
   public:
     using NEO::FileLogger<debugLevel>::FileLogger;
+    using NEO::FileLogger<debugLevel>::closeLogFile;
+    using NEO::FileLogger<debugLevel>::logFile;
 
     ~TestFileLogger() override {
+        closeLogFile();
         std::remove(NEO::FileLogger<debugLevel>::logFileName.c_str());
     }
 
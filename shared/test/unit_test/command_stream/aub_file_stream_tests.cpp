@@ -1023,3 +1023,54 @@ HWTEST_F(AubFileStreamTests, givenAubCommandStreamReceiverWithAubManagerWhenInit
 
     EXPECT_EQ(expectedAddedComments, mockAubManager->receivedComments);
 }
+
+TEST(AubFileStreamAsyncWriterTest, givenAsyncWriterBufferSizeSetWhenWritingToAubFileStreamThenDataIsWrittenToFileInOrderOnClose) {
+    struct AubFileStreamWithAsyncWriter : AubMemDump::AubFileStream {
+        using AubMemDump::AubFileStream::asyncBufferSize;
+        using AubMemDump::AubFileStream::asyncWriter;
+    };
+
+    DebugManagerStateRestore restorer;
+    debugManager.flags.AubDumpAsyncWriterBufferSize.set(1);
+
+    const std::string fileName = "aub_async_writer_test.aub";
+    std::vector<char> expectedData;
+    {
+        AubFileStreamWithAsyncWriter aubFileStream;
+        aubFileStream.open(fileName.c_str());
+        ASSERT_TRUE(aubFileStream.isOpen());
+        EXPECT_NE(nullptr, aubFileStream.asyncWriter);
+        EXPECT_EQ(MemoryConstants::kiloByte, aubFileStream.asyncBufferSize);
+
+        for (uint32_t i = 0; i < 1000u; i++) {
+            uint64_t entry = 0x1000u * i;
+            aubFileStream.writePTE(0u, entry, 0u);
+            expectedData.insert(expectedData.end(), reinterpret_cast<char *>(&entry), reinterpret_cast<char *>(&entry + 1));
+            if (i % 100 == 0) {
+                aubFileStream.flush();
+            }
+        }
+        aubFileStream.close();
+        EXPECT_EQ(nullptr, aubFileStream.asyncWriter);
+    }
+
+    std::ifstream file(fileName, std::ios::binary);
+    std::vector<char> fileData((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    std::remove(fileName.c_str());
+
+    EXPECT_EQ(expectedData, fileData);
+}
+
+TEST(AubFileStreamAsyncWriterTest, givenDefaultAsyncWriterBufferSizeWhenOpeningAubFileStreamThenAsyncWriterIsNotCreated) {
+    struct AubFileStreamWithAsyncWriter : AubMemDump::AubFileStream {
+        using AubMemDump::AubFileStream::asyncWriter;
+    };
+
+    const std::string fileName = "aub_async_writer_test.aub";
+    AubFileStreamWithAsyncWriter aubFileStream;
+    aubFileStream.open(fileName.c_str());
+    EXPECT_EQ(nullptr, aubFileStream.asyncWriter);
+    aubFileStream.close();
+    std::remove(fileName.c_str());
+}
@@ -78,6 +78,16 @@ struct MockTbxCsrToTestDumpTbxNonWritable : public TbxCommandStreamReceiverHw<Gf
     }
 };
 
+template <typename GfxFamily>
+struct MockTbxCsrWithUploadChunks : public TbxCommandStreamReceiverHw<GfxFamily> {
+    using TbxCommandStreamReceiverHw<GfxFamily>::TbxCommandStreamReceiverHw;
+    using TbxCommandStreamReceiverHw<GfxFamily>::getChunksToUpload;
+    using TbxCommandStreamReceiverHw<GfxFamily>::invalidateUploadedPages;
+    using TbxCommandStreamReceiverHw<GfxFamily>::skippedBytes;
+    using TbxCommandStreamReceiverHw<GfxFamily>::uploadedBytes;
+    using TbxCommandStreamReceiverHw<GfxFamily>::uploadedPages;
+};
+
 TEST(TbxCommandStreamReceiverTest, givenNullFactoryEntryWhenTbxCsrIsCreatedThenNullptrIsReturned) {
     auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
     GFXCORE_FAMILY family = executionEnvironment->rootDeviceEnvironments[0]->getHardwareInfo()->platform.eRenderCoreFamily;
@@ -1181,3 +1191,104 @@ HWTEST_F(TbxCommandStreamTests, givenTimestampBufferAllocationWhenTbxWriteMemory
 
     memoryManager->freeGraphicsMemory(timestampAllocation);
 }
+
+HWTEST_F(TbxCommandStreamTests, givenUploadOnlyChangedPagesEnabledWhenGettingChunksToUploadThenOnlyChangedPagesAreReturned) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.AubTbxUploadOnlyChangedPages.set(true);
+
+    MockTbxCsrWithUploadChunks<FamilyType> tbxCsr(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    std::vector<uint8_t> memory(4 * MemoryConstants::pageSize, 0u);
+    MockGraphicsAllocation allocation(memory.data(), memory.size());
+    const uint64_t gpuAddress = 0x100000;
+
+    auto chunks = tbxCsr.getChunksToUpload(allocation, gpuAddress, memory.data(), memory.size());
+    ASSERT_EQ(1u, chunks.size());
+    EXPECT_EQ(0u, chunks[0].first);
+    EXPECT_EQ(memory.size(), chunks[0].second);
+    EXPECT_EQ(memory.size(), tbxCsr.uploadedBytes);
+
+    chunks = tbxCsr.getChunksToUpload(allocation, gpuAddress, memory.data(), memory.size());
+    EXPECT_TRUE(chunks.empty());
+    EXPECT_EQ(memory.size(), tbxCsr.skippedBytes);
+
+    memory[MemoryConstants::pageSize + 1] = 1u;
+    memory[2 * MemoryConstants::pageSize + 2] = 1u;
+    chunks = tbxCsr.getChunksToUpload(allocation, gpuAddress, memory.data(), memory.size());
+    ASSERT_EQ(1u, chunks.size());
+    EXPECT_EQ(MemoryConstants::pageSize, chunks[0].first);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, chunks[0].second);
+    EXPECT_EQ(memory.size() + 2 * MemoryConstants::pageSize, tbxCsr.uploadedBytes);
+}
+
+HWTEST_F(TbxCommandStreamTests, givenUploadOnlyChangedPagesEnabledWhenGpuAddressIsReusedByAnotherAllocationThenWholeAllocationIsUploadedAgain) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.AubTbxUploadOnlyChangedPages.set(true);
+
+    MockTbxCsrWithUploadChunks<FamilyType> tbxCsr(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    std::vector<uint8_t> memory(2 * MemoryConstants::pageSize, 0u);
+    const uint64_t gpuAddress = 0x100000;
+
+    {
+        MockGraphicsAllocation allocation(memory.data(), memory.size());
+        EXPECT_EQ(1u, tbxCsr.getChunksToUpload(allocation, gpuAddress, memory.data(), memory.size()).size());
+        EXPECT_TRUE(tbxCsr.getChunksToUpload(allocation, gpuAddress, memory.data(), memory.size()).empty());
+    }
+
+    MockGraphicsAllocation otherAllocation(memory.data(), memory.size());
+    auto chunks = tbxCsr.getChunksToUpload(otherAllocation, gpuAddress, memory.data(), memory.size());
+    ASSERT_EQ(1u, chunks.size());
+    EXPECT_EQ(memory.size(), chunks[0].second);
+    EXPECT_EQ(1u, tbxCsr.uploadedPages.size());
+    EXPECT_EQ(otherAllocation.getAllocationId(), tbxCsr.uploadedPages[gpuAddress].allocationId);
+
+    EXPECT_TRUE(tbxCsr.getChunksToUpload(otherAllocation, gpuAddress, memory.data(), memory.size()).empty());
+}
+
+HWTEST_F(TbxCommandStreamTests, givenUploadOnlyChangedPagesEnabledWhenPagesOfReplacedAllocationAreInvalidatedThenCurrentAllocationPagesAreKept) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.AubTbxUploadOnlyChangedPages.set(true);
+
+    MockTbxCsrWithUploadChunks<FamilyType> tbxCsr(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    std::vector<uint8_t> memory(2 * MemoryConstants::pageSize, 0u);
+    MockGraphicsAllocation allocation(memory.data(), memory.size());
+    MockGraphicsAllocation otherAllocation(memory.data(), memory.size());
+    const uint64_t gpuAddress = 0x100000;
+
+    tbxCsr.getChunksToUpload(otherAllocation, gpuAddress, memory.data(), memory.size());
+    tbxCsr.invalidateUploadedPages(allocation, gpuAddress, 0u, memory.size());
+
+    EXPECT_TRUE(tbxCsr.getChunksToUpload(otherAllocation, gpuAddress, memory.data(), memory.size()).empty());
+}
+
+HWTEST_F(TbxCommandStreamTests, givenUploadOnlyChangedPagesEnabledWhenUploadedPagesAreInvalidatedThenOnlyInvalidatedPagesAreUploadedAgain) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.AubTbxUploadOnlyChangedPages.set(true);
+
+    MockTbxCsrWithUploadChunks<FamilyType> tbxCsr(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    std::vector<uint8_t> memory(4 * MemoryConstants::pageSize, 0u);
+    MockGraphicsAllocation allocation(memory.data(), memory.size());
+    const uint64_t gpuAddress = 0x100000;
+
+    tbxCsr.getChunksToUpload(allocation, gpuAddress, memory.data(), memory.size());
+    tbxCsr.invalidateUploadedPages(allocation, gpuAddress, MemoryConstants::pageSize + 1, MemoryConstants::pageSize);
+
+    auto chunks = tbxCsr.getChunksToUpload(allocation, gpuAddress, memory.data(), memory.size());
+    ASSERT_EQ(1u, chunks.size());
+    EXPECT_EQ(MemoryConstants::pageSize, chunks[0].first);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, chunks[0].second);
+}
+
+HWTEST_F(TbxCommandStreamTests, givenUploadOnlyChangedPagesDisabledWhenGettingChunksToUploadThenWholeAllocationIsAlwaysReturned) {
+    MockTbxCsrWithUploadChunks<FamilyType> tbxCsr(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    std::vector<uint8_t> memory(2 * MemoryConstants::pageSize, 0u);
+    MockGraphicsAllocation allocation(memory.data(), memory.size());
+    const uint64_t gpuAddress = 0x100000;
+
+    for (int i = 0; i < 2; i++) {
+        auto chunks = tbxCsr.getChunksToUpload(allocation, gpuAddress, memory.data(), memory.size());
+        ASSERT_EQ(1u, chunks.size());
+        EXPECT_EQ(0u, chunks[0].first);
+        EXPECT_EQ(memory.size(), chunks[0].second);
+    }
+    EXPECT_EQ(0u, tbxCsr.skippedBytes);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,13 +7,47 @@
 
 #include "shared/source/command_stream/tbx_command_stream_receiver_hw.h"
 #include "shared/source/tbx/tbx_proto.h"
+#include "shared/source/tbx/tbx_sockets_imp.h"
 #include "shared/test/common/mocks/mock_tbx_sockets.h"
 #include "shared/test/unit_test/mocks/mock_tbx_stream.h"
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <vector>
+
 using namespace NEO;
 
+struct MockTbxSocketsImpWithSendCapture : public TbxSocketsImp {
+    MockTbxSocketsImpWithSendCapture() : TbxSocketsImp(errStream) {}
+
+    using TbxSocketsImp::pendingWrites;
+    using TbxSocketsImp::pendingWritesCapacity;
+
+    int64_t sendBuffers(const char *const *buffers, const size_t *sizes, uint32_t count) override {
+        sendBuffersCalled++;
+        size_t bytesSent = 0;
+        for (auto i = 0u; i < count; i++) {
+            if (sizes[i] > 0) {
+                sentBuffers.push_back(buffers[i]);
+            }
+            auto bytesToSend = std::min(sizes[i], maxBytesPerSend - bytesSent);
+            sentData.insert(sentData.end(), buffers[i], buffers[i] + bytesToSend);
+            bytesSent += bytesToSend;
+        }
+        return static_cast<int64_t>(bytesSent);
+    }
+
+    std::stringstream errStream;
+    std::vector<char> sentData;
+    std::vector<const char *> sentBuffers;
+    size_t maxBytesPerSend = std::numeric_limits<size_t>::max();
+    uint32_t sendBuffersCalled = 0u;
+};
+
 TEST(TbxStreamTests, givenTbxStreamWhenWriteMemoryIsCalledThenMemTypeIsSetCorrectly) {
     std::unique_ptr<TbxCommandStreamReceiver::TbxStream> mockTbxStream(new MockTbxStream());
     MockTbxStream *mockTbxStreamPtr = static_cast<MockTbxStream *>(mockTbxStream.get());
@@ -37,3 +71,56 @@ TEST(TbxStreamTests, givenTbxStreamWhenWriteMemoryIsCalledThenMemTypeIsSetCorrec
     mockTbxStream->writePTE(0, 0, addressSpace);
     EXPECT_EQ(MemType::system, mockTbxSocket->typeCapturedFromWriteMemory);
 }
+
+TEST(TbxSocketsImpTests, givenMemoryAndGttWritesWhenWritingMmioThenAllRequestsAreSentInOrderWithSingleSend) {
+    MockTbxSocketsImpWithSendCapture tbxSockets;
+    uint32_t data[4] = {1u, 2u, 3u, 4u};
+
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1000, data, sizeof(data), 0u));
+    EXPECT_TRUE(tbxSockets.writeMemory(0x2000, data, sizeof(data), 0u));
+    EXPECT_TRUE(tbxSockets.writeGTT(0x8, 0x1234));
+    EXPECT_EQ(0u, tbxSockets.sendBuffersCalled);
+
+    EXPECT_TRUE(tbxSockets.writeMMIO(0x2030, 0x10));
+    EXPECT_EQ(1u, tbxSockets.sendBuffersCalled);
+    EXPECT_TRUE(tbxSockets.pendingWrites.empty());
+
+    const size_t writeMemorySize = sizeof(HasHdr) + sizeof(HasWriteDataReq) + sizeof(data);
+    const size_t expectedSize = 2 * writeMemorySize + sizeof(HasHdr) + sizeof(HasGtt64Req) + sizeof(HasHdr) + sizeof(HasMmioReq);
+    ASSERT_EQ(expectedSize, tbxSockets.sentData.size());
+
+    const uint32_t expectedMsgTypes[] = {HAS_WRITE_DATA_REQ_TYPE, HAS_WRITE_DATA_REQ_TYPE, HAS_GTT_REQ_TYPE, HAS_MMIO_REQ_TYPE};
+    const size_t messageOffsets[] = {0u, writeMemorySize, 2 * writeMemorySize, 2 * writeMemorySize + sizeof(HasHdr) + sizeof(HasGtt64Req)};
+    for (auto i = 0u; i < 4u; i++) {
+        auto header = reinterpret_cast<const HasHdr *>(tbxSockets.sentData.data() + messageOffsets[i]);
+        EXPECT_EQ(expectedMsgTypes[i], header->msgType);
+        EXPECT_EQ(i, header->transID);
+    }
+    EXPECT_EQ(0, memcmp(data, tbxSockets.sentData.data() + sizeof(HasHdr) + sizeof(HasWriteDataReq), sizeof(data)));
+}
+
+TEST(TbxSocketsImpTests, givenWriteLargerThanPendingWritesCapacityWhenWritingMemoryThenPayloadIsSentWithoutCopyTogetherWithPendingWrites) {
+    MockTbxSocketsImpWithSendCapture tbxSockets;
+    std::vector<char> data(MockTbxSocketsImpWithSendCapture::pendingWritesCapacity + 1, 'x');
+
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1000, data.data(), data.size(), 0u));
+    EXPECT_EQ(1u, tbxSockets.sendBuffersCalled);
+    EXPECT_TRUE(tbxSockets.pendingWrites.empty());
+    ASSERT_EQ(2u, tbxSockets.sentBuffers.size());
+    EXPECT_EQ(data.data(), tbxSockets.sentBuffers[1]);
+    EXPECT_EQ(sizeof(HasHdr) + sizeof(HasWriteDataReq) + data.size(), tbxSockets.sentData.size());
+}
+
+TEST(TbxSocketsImpTests, givenPartialSendsWhenSendingPendingWritesThenRemainingDataIsSentUntilComplete) {
+    MockTbxSocketsImpWithSendCapture tbxSockets;
+    tbxSockets.maxBytesPerSend = 7u;
+    uint32_t data[8] = {1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u};
+
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1000, data, sizeof(data), 0u));
+    EXPECT_TRUE(tbxSockets.writeMMIO(0x2030, 0x10));
+
+    const size_t expectedSize = sizeof(HasHdr) + sizeof(HasWriteDataReq) + sizeof(data) + sizeof(HasHdr) + sizeof(HasMmioReq);
+    ASSERT_EQ(expectedSize, tbxSockets.sentData.size());
+    EXPECT_EQ((expectedSize + tbxSockets.maxBytesPerSend - 1) / tbxSockets.maxBytesPerSend, tbxSockets.sendBuffersCalled);
+    EXPECT_EQ(0, memcmp(data, tbxSockets.sentData.data() + sizeof(HasHdr) + sizeof(HasWriteDataReq), sizeof(data)));
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -147,3 +147,24 @@ TEST(ArEncoder, GivenValidTwoFileEntriesWhen8BytePaddingIsRequestedThenPaddingFi
     EXPECT_EQ(0, memcmp(file1Data, data1, sizeof(data1)));
     EXPECT_EQ(0, memcmp(file2Data, data2, sizeof(data2)));
 }
+
+TEST(ArEncoder, GivenManyFileEntriesWhenAppendingThenPreviousEntriesAreNotReallocatedOnEachAppend) {
+    struct MockArEncoder : ArEncoder {
+        using ArEncoder::ArEncoder;
+        using ArEncoder::fileEntries;
+    };
+
+    MockArEncoder encoder{true};
+    const std::vector<uint8_t> fileData(4096, 7U);
+    constexpr size_t numFiles = 64U;
+    size_t reallocations = 0U;
+    for (size_t i = 0; i < numFiles; ++i) {
+        auto previousData = encoder.fileEntries.data();
+        ASSERT_NE(nullptr, encoder.appendFileEntry("file" + std::to_string(i), ArrayRef<const uint8_t>(fileData)));
+        reallocations += (previousData != encoder.fileEntries.data()) ? 1U : 0U;
+    }
+    EXPECT_GT(numFiles / 4, reallocations);
+
+    auto arData = encoder.encode();
+    EXPECT_EQ(arMagic.size() + encoder.fileEntries.size(), arData.size());
+}
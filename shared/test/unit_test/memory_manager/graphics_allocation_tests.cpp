@@ -32,6 +32,14 @@ TEST(GraphicsAllocationTest, givenGraphicsAllocationWhenIsCreatedThenTaskCountsA
     }
 }
 
+TEST(GraphicsAllocationTest, givenGraphicsAllocationsWhenCreatedThenEachHasUniqueNonZeroAllocationId) {
+    GraphicsAllocation graphicsAllocation1(0, 1u /*num gmms*/, AllocationType::unknown, nullptr, 0u, 0u, 0, MemoryPool::memoryNull, MemoryManager::maxOsContextCount);
+    GraphicsAllocation graphicsAllocation2(0, 1u /*num gmms*/, AllocationType::unknown, nullptr, 0u, 0u, 0, MemoryPool::memoryNull, MemoryManager::maxOsContextCount);
+    EXPECT_NE(0u, graphicsAllocation1.getAllocationId());
+    EXPECT_NE(0u, graphicsAllocation2.getAllocationId());
+    EXPECT_NE(graphicsAllocation1.getAllocationId(), graphicsAllocation2.getAllocationId());
+}
+
 TEST(GraphicsAllocationTest, givenGraphicsAllocationWhenUpdatedTaskCountThenAllocationWasUsed) {
     MockGraphicsAllocation graphicsAllocation;
     EXPECT_FALSE(graphicsAllocation.isUsed());
@@ -5,6 +5,8 @@
  *
  */
 
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/test/common/fixtures/memory_allocator_fixture.h"
@@ -326,3 +328,116 @@ TEST_F(InternalAllocationStorageTest, givenInternalAllocationWhenTaskCountMetsEx
     EXPECT_FALSE(csr->getTemporaryAllocations().peekIsEmpty());
     allocation->hostPtrTaskCountAssignment = 0;
 }
+
+struct HostPtrImportCacheTest : public InternalAllocationStorageTest {
+    void SetUp() override {
+        debugManager.flags.ExperimentalHostPtrImportCacheSize.set(1);
+        InternalAllocationStorageTest::SetUp();
+        hostPtr = alignedMalloc(hostPtrSize, MemoryConstants::pageSize64k);
+    }
+
+    void TearDown() override {
+        storage->cleanHostPtrImportCache();
+        alignedFree(hostPtr);
+        InternalAllocationStorageTest::TearDown();
+    }
+
+    GraphicsAllocation *storeCompletedHostPtrAllocation(void *ptr, size_t size) {
+        auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), false, size, AllocationType::externalHostPtr}, ptr);
+        allocation->updateTaskCount(1u, csr->getOsContext().getContextId());
+        storage->storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation), TEMPORARY_ALLOCATION);
+        storage->cleanAllocationList(1u, TEMPORARY_ALLOCATION);
+        return allocation;
+    }
+
+    DebugManagerStateRestore restorer;
+    static constexpr size_t hostPtrSize = 2 * MemoryConstants::megaByte;
+    void *hostPtr = nullptr;
+};
+
+TEST_F(HostPtrImportCacheTest, givenCompletedHostPtrAllocationWhenTemporaryListIsCleanedThenAllocationIsCachedAndReusedForSamePointer) {
+    const size_t size = MemoryConstants::pageSize64k;
+    auto allocation = storeCompletedHostPtrAllocation(hostPtr, size);
+
+    EXPECT_TRUE(csr->getTemporaryAllocations().peekIsEmpty());
+    EXPECT_TRUE(storage->getHostPtrImportCache().peekContains(*allocation));
+    EXPECT_EQ(size, storage->getHostPtrImportCacheSize());
+
+    EXPECT_EQ(nullptr, storage->obtainHostPtrImportAllocation(size, ptrOffset(hostPtr, MemoryConstants::pageSize)));
+    EXPECT_EQ(nullptr, storage->obtainHostPtrImportAllocation(2 * size, hostPtr));
+
+    auto cachedAllocation = storage->obtainHostPtrImportAllocation(size / 2, hostPtr);
+    EXPECT_EQ(allocation, cachedAllocation.get());
+    EXPECT_TRUE(storage->getHostPtrImportCache().peekIsEmpty());
+    EXPECT_EQ(0u, storage->getHostPtrImportCacheSize());
+
+    memoryManager->freeGraphicsMemory(cachedAllocation.release());
+}
+
+TEST_F(HostPtrImportCacheTest, givenHostPtrAllocationNotMeetingCacheRequirementsWhenTemporaryListIsCleanedThenAllocationIsReleased) {
+    storeCompletedHostPtrAllocation(hostPtr, MemoryConstants::pageSize);
+    storeCompletedHostPtrAllocation(ptrOffset(hostPtr, MemoryConstants::cacheLineSize), MemoryConstants::pageSize64k);
+
+    debugManager.flags.ExperimentalHostPtrImportCacheSize.set(-1);
+    storeCompletedHostPtrAllocation(hostPtr, MemoryConstants::pageSize64k);
+
+    EXPECT_TRUE(csr->getTemporaryAllocations().peekIsEmpty());
+    EXPECT_TRUE(storage->getHostPtrImportCache().peekIsEmpty());
+    EXPECT_EQ(0u, storage->getHostPtrImportCacheSize());
+}
+
+TEST_F(HostPtrImportCacheTest, givenCacheSizeLimitExceededWhenAllocationIsCachedThenLeastRecentlyUsedAllocationIsEvicted) {
+    const size_t size = MemoryConstants::megaByte / 2;
+    auto allocation1 = storeCompletedHostPtrAllocation(hostPtr, size);
+    auto allocation2 = storeCompletedHostPtrAllocation(ptrOffset(hostPtr, size), size);
+    EXPECT_EQ(2 * size, storage->getHostPtrImportCacheSize());
+
+    auto reusedAllocation = storage->obtainHostPtrImportAllocation(size, hostPtr);
+    EXPECT_EQ(allocation1, reusedAllocation.get());
+    reusedAllocation->updateTaskCount(1u, csr->getOsContext().getContextId());
+    storage->storeAllocation(std::move(reusedAllocation), TEMPORARY_ALLOCATION);
+    storage->cleanAllocationList(1u, TEMPORARY_ALLOCATION);
+    EXPECT_EQ(-1, verifyDListOrder(storage->getHostPtrImportCache().peekHead(), allocation2, allocation1));
+
+    storeCompletedHostPtrAllocation(ptrOffset(hostPtr, 2 * size), MemoryConstants::pageSize64k);
+    EXPECT_FALSE(storage->getHostPtrImportCache().peekContains(*allocation2));
+    EXPECT_TRUE(storage->getHostPtrImportCache().peekContains(*allocation1));
+    EXPECT_EQ(size + MemoryConstants::pageSize64k, storage->getHostPtrImportCacheSize());
+}
+
+TEST_F(HostPtrImportCacheTest, givenCachedAllocationsWhenTemporaryAllocationsAreCleanedOnAllEnginesThenCacheIsReleased) {
+    storeCompletedHostPtrAllocation(hostPtr, MemoryConstants::pageSize64k);
+    EXPECT_FALSE(storage->getHostPtrImportCache().peekIsEmpty());
+
+    memoryManager->cleanTemporaryAllocationListOnAllEngines(false);
+    EXPECT_TRUE(storage->getHostPtrImportCache().peekIsEmpty());
+    EXPECT_EQ(0u, storage->getHostPtrImportCacheSize());
+}
+
+TEST_F(HostPtrImportCacheTest, givenCachedAllocationsWhenOverlappingRangeIsInvalidatedThenOnlyOverlappingAllocationsAreReleased) {
+    const size_t size = MemoryConstants::pageSize64k;
+    auto allocation1 = storeCompletedHostPtrAllocation(hostPtr, size);
+    auto allocation2 = storeCompletedHostPtrAllocation(ptrOffset(hostPtr, 2 * size), size);
+    auto allocation3 = storeCompletedHostPtrAllocation(ptrOffset(hostPtr, 4 * size), size);
+
+    storage->invalidateHostPtrImports(ptrOffset(hostPtr, 2 * size + MemoryConstants::pageSize), MemoryConstants::pageSize);
+    EXPECT_FALSE(storage->getHostPtrImportCache().peekContains(*allocation2));
+    EXPECT_EQ(-1, verifyDListOrder(storage->getHostPtrImportCache().peekHead(), allocation1, allocation3));
+    EXPECT_EQ(2 * size, storage->getHostPtrImportCacheSize());
+
+    storage->invalidateHostPtrImports(ptrOffset(hostPtr, size), size);
+    EXPECT_EQ(2 * size, storage->getHostPtrImportCacheSize());
+}
+
+TEST_F(HostPtrImportCacheTest, givenCachedAllocationWhenDriverAllocationCoveringItsRangeIsFreedThenCachedAllocationIsReleased) {
+    const size_t size = MemoryConstants::pageSize64k;
+    storeCompletedHostPtrAllocation(hostPtr, size);
+
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), false, size, AllocationType::bufferHostMemory}, hostPtr);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(size, storage->getHostPtrImportCacheSize());
+
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_TRUE(storage->getHostPtrImportCache().peekIsEmpty());
+    EXPECT_EQ(0u, storage->getHostPtrImportCacheSize());
+}
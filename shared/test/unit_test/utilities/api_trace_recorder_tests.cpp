@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/api_trace_recorder.h"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace NEO;
+
+struct MockApiTraceRecorder : public ApiTraceRecorder {
+    using ApiTraceRecorder::ApiTraceRecorder;
+    using ApiTraceRecorder::threadEventsList;
+    using ApiTraceRecorder::writePendingEvents;
+};
+
+namespace {
+size_t countOccurrences(const std::string &str, const std::string &token) {
+    size_t count = 0u;
+    for (auto pos = str.find(token); pos != std::string::npos; pos = str.find(token, pos + token.size())) {
+        count++;
+    }
+    return count;
+}
+} // namespace
+
+TEST(ApiTraceRecorderTest, givenTraceFileNameUnkWhenCreatingRecorderThenNullptrIsReturned) {
+    EXPECT_EQ(nullptr, ApiTraceRecorder::create("unk"));
+}
+
+TEST(ApiTraceRecorderTest, givenRecordedEventsWhenRecorderIsDestroyedThenPendingEventsAreWrittenAndTraceIsClosed) {
+    std::stringbuf traceBuffer;
+    {
+        MockApiTraceRecorder recorder(std::make_unique<std::ostream>(&traceBuffer), 123u);
+        recorder.record("clFirstCall", recorder.getTimestamp(), 0);
+        EXPECT_EQ(1u, recorder.threadEventsList[0]->events.size());
+        EXPECT_STREQ("[\n", traceBuffer.str().c_str());
+    }
+
+    auto trace = traceBuffer.str();
+    EXPECT_EQ(1u, countOccurrences(trace, "clFirstCall"));
+    EXPECT_EQ(trace.size() - 3, trace.rfind("\n]\n"));
+}
+
+TEST(ApiTraceRecorderTest, givenRecordedEventsWhenWritingPendingEventsThenEventsOfAllThreadsAreWrittenInChromeTraceFormat) {
+    auto traceOut = std::make_unique<std::stringstream>();
+    auto traceStream = traceOut.get();
+    MockApiTraceRecorder recorder(std::move(traceOut), 123u);
+
+    recorder.record("clFirstCall", recorder.getTimestamp(), 0);
+    std::thread otherThread([&recorder]() {
+        recorder.record("clSecondCall", recorder.getTimestamp(), -5);
+    });
+    otherThread.join();
+    EXPECT_EQ(2u, recorder.threadEventsList.size());
+
+    recorder.writePendingEvents();
+    auto trace = traceStream->str();
+    EXPECT_EQ(0u, trace.find("[\n{\"name\":\"clFirstCall\",\"ph\":\"X\",\"pid\":123,\"tid\":1,\"ts\":"));
+    EXPECT_NE(std::string::npos, trace.find(",\n{\"name\":\"clSecondCall\",\"ph\":\"X\",\"pid\":123,\"tid\":2,\"ts\":"));
+    EXPECT_NE(std::string::npos, trace.find("\"args\":{\"ret\":-5}}"));
+    EXPECT_EQ(2u, countOccurrences(trace, "\"dur\":"));
+}
+
+TEST(ApiTraceRecorderTest, givenFullChunkOfEventsWhenRecordingThenChunkIsWrittenImmediately) {
+    auto traceOut = std::make_unique<std::stringstream>();
+    auto traceStream = traceOut.get();
+    MockApiTraceRecorder recorder(std::move(traceOut), 1u);
+
+    for (size_t i = 0; i < ApiTraceRecorder::eventsPerChunk - 1; i++) {
+        recorder.record("clCall", recorder.getTimestamp(), 0);
+    }
+    EXPECT_EQ(0u, countOccurrences(traceStream->str(), "clCall"));
+
+    recorder.record("clCall", recorder.getTimestamp(), 0);
+    EXPECT_EQ(ApiTraceRecorder::eventsPerChunk, countOccurrences(traceStream->str(), "clCall"));
+    EXPECT_TRUE(recorder.threadEventsList[0]->events.empty());
+}
+
+TEST(ApiTraceRecorderTest, givenFinishedTraceWhenRecordingOrFinishingAgainThenEventsAreDroppedAndTraceIsClosedOnce) {
+    std::stringbuf traceBuffer;
+    {
+        MockApiTraceRecorder recorder(std::make_unique<std::ostream>(&traceBuffer), 123u);
+        recorder.record("clFirstCall", recorder.getTimestamp(), 0);
+        recorder.finish();
+        EXPECT_EQ(1u, countOccurrences(traceBuffer.str(), "clFirstCall"));
+
+        recorder.record("clSecondCall", recorder.getTimestamp(), 0);
+        EXPECT_TRUE(recorder.threadEventsList[0]->events.empty());
+        recorder.finish();
+    }
+
+    auto trace = traceBuffer.str();
+    EXPECT_EQ(0u, countOccurrences(trace, "clSecondCall"));
+    EXPECT_EQ(1u, countOccurrences(trace, "\n]\n"));
+    EXPECT_EQ(trace.size() - 3, trace.rfind("\n]\n"));
+}
+
+TEST(ApiTraceRecorderTest, givenEventsRecordedOnOtherThreadWhenFinishingTraceConcurrentlyThenEveryWrittenEventIsComplete) {
+    auto traceOut = std::make_unique<std::stringstream>();
+    auto traceStream = traceOut.get();
+    MockApiTraceRecorder recorder(std::move(traceOut), 1u);
+
+    std::thread otherThread([&recorder]() {
+        for (size_t i = 0; i < 2 * ApiTraceRecorder::eventsPerChunk; i++) {
+            recorder.record("clCall", recorder.getTimestamp(), 0);
+        }
+    });
+    recorder.finish();
+    otherThread.join();
+
+    auto trace = traceStream->str();
+    EXPECT_EQ(countOccurrences(trace, "clCall"), countOccurrences(trace, "\"args\":{\"ret\":0}}"));
+    EXPECT_EQ(trace.size() - 3, trace.rfind("\n]\n"));
+}
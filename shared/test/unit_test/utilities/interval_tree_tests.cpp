@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/interval_tree.h"
+
+#include "gtest/gtest.h"
+
+using TestedIntervalTree = NEO::IntervalTree<uint32_t>;
+
+TEST(IntervalTreeTest, givenEmptyTreeWhenQueryingThenNothingIsFound) {
+    TestedIntervalTree tree;
+    EXPECT_EQ(0u, tree.size());
+    EXPECT_EQ(nullptr, tree.find(reinterpret_cast<void *>(0x1000)));
+    EXPECT_EQ(nullptr, tree.findIntersecting(0u, UINTPTR_MAX, [](const auto &) { return true; }));
+    EXPECT_FALSE(tree.remove(reinterpret_cast<void *>(0x1000)));
+}
+
+TEST(IntervalTreeTest, givenIntervalsInsertedOutOfOrderWhenFindingIntersectingThenFirstIntersectingIntervalInAddressOrderIsReturned) {
+    TestedIntervalTree tree;
+    tree.insert(reinterpret_cast<void *>(0x3000), 0x100, 3u);
+    tree.insert(reinterpret_cast<void *>(0x1000), 0x4000, 1u);
+    tree.insert(reinterpret_cast<void *>(0x2000), 0x100, 2u);
+    tree.insert(reinterpret_cast<void *>(0x6000), 0x100, 4u);
+    EXPECT_EQ(4u, tree.size());
+
+    auto interval = tree.findIntersecting(0x3050, 0x3050, [](const auto &) { return true; });
+    ASSERT_NE(nullptr, interval);
+    EXPECT_EQ(1u, interval->value);
+
+    interval = tree.findIntersecting(0x3050, 0x3050, [](const auto &candidate) { return candidate.value != 1u; });
+    ASSERT_NE(nullptr, interval);
+    EXPECT_EQ(3u, interval->value);
+
+    EXPECT_EQ(nullptr, tree.findIntersecting(0x5100, 0x5fff, [](const auto &) { return true; }));
+    interval = tree.findIntersecting(0x5100, 0x6000, [](const auto &) { return true; });
+    ASSERT_NE(nullptr, interval);
+    EXPECT_EQ(4u, interval->value);
+}
+
+TEST(IntervalTreeTest, givenIntervalsWithSameStartWhenRemovingThenIntervalMatchingPredicateIsRemoved) {
+    TestedIntervalTree tree;
+    auto ptr = reinterpret_cast<void *>(0x1000);
+    tree.insert(ptr, 0x100, 1u);
+    tree.insert(ptr, 0x100, 2u);
+    EXPECT_EQ(1u, *tree.find(ptr));
+
+    EXPECT_TRUE(tree.remove(ptr, [](uint32_t value) { return value == 2u; }));
+    EXPECT_EQ(1u, tree.size());
+    EXPECT_EQ(1u, *tree.find(ptr));
+
+    EXPECT_FALSE(tree.remove(ptr, [](uint32_t value) { return value == 2u; }));
+    EXPECT_TRUE(tree.remove(ptr));
+    EXPECT_EQ(nullptr, tree.find(ptr));
+}
+
+TEST(IntervalTreeTest, givenIntervalsWhenRemovingAllMatchingPredicateThenRemainingIntervalsAreStillFound) {
+    TestedIntervalTree tree;
+    for (uint32_t i = 0; i < 100; i++) {
+        tree.insert(reinterpret_cast<void *>(0x1000 * (i + 1)), 0x800, i);
+    }
+
+    EXPECT_EQ(50u, tree.removeAll([](uint32_t value) { return value % 2 == 0; }));
+    EXPECT_EQ(50u, tree.size());
+
+    for (uint32_t i = 0; i < 100; i++) {
+        uintptr_t address = 0x1000 * (i + 1) + 0x10;
+        auto interval = tree.findIntersecting(address, address, [](const auto &) { return true; });
+        if (i % 2 == 0) {
+            EXPECT_EQ(nullptr, interval);
+        } else {
+            ASSERT_NE(nullptr, interval);
+            EXPECT_EQ(i, interval->value);
+        }
+    }
+}
+
+TEST(IntervalTreeTest, givenLongestIntervalRemovedWhenFindingIntersectingThenRemainingIntervalsAreFound) {
+    TestedIntervalTree tree;
+    tree.insert(reinterpret_cast<void *>(0x1000), 0x10000, 1u);
+    tree.insert(reinterpret_cast<void *>(0x4000), 0x100, 2u);
+    tree.insert(reinterpret_cast<void *>(0x8000), 0x100, 3u);
+
+    auto interval = tree.findIntersecting(0x8050, 0x8050, [](const auto &) { return true; });
+    ASSERT_NE(nullptr, interval);
+    EXPECT_EQ(1u, interval->value);
+
+    EXPECT_TRUE(tree.remove(reinterpret_cast<void *>(0x1000)));
+    interval = tree.findIntersecting(0x8050, 0x8050, [](const auto &) { return true; });
+    ASSERT_NE(nullptr, interval);
+    EXPECT_EQ(3u, interval->value);
+    EXPECT_EQ(nullptr, tree.findIntersecting(0x6000, 0x7000, [](const auto &) { return true; }));
+}
@@ -140,6 +140,69 @@ TEST(FileLogger, GivenSameFileNameWhenCreatingNewFullyDisabledLoggerThenOldFileI
     std::remove(fileLogger.getLogFileName());
 }
 
+TEST(FileLogger, GivenRealFilesWhenAppendingToLogFileThenFileIsKeptOpenAndEachEntryIsWritten) {
+    std::string testFile = "testfile";
+    DebugVariables flags;
+    FullyEnabledFileLogger fileLogger(testFile, flags);
+    fileLogger.useRealFiles(true);
+
+    fileLogger.writeToFile(testFile, "abc", 3, std::ios::app);
+    EXPECT_TRUE(fileLogger.logFile.is_open());
+    fileLogger.writeToFile(testFile, "def", 3, std::ios::app);
+
+    std::ifstream logFile(testFile);
+    std::stringstream fileContent;
+    fileContent << logFile.rdbuf();
+    EXPECT_STREQ("abcdef", fileContent.str().c_str());
+}
+
+TEST(FileLogger, GivenLogFileBufferSizeWhenAppendingToLogFileThenEntriesAreWrittenWhenBufferIsFullOrLogFileIsClosed) {
+    std::string testFile = "testfile";
+    DebugVariables flags;
+    flags.LogFileBufferSize.set(1);
+    FullyEnabledFileLogger fileLogger(testFile, flags);
+    fileLogger.useRealFiles(true);
+
+    auto getFileSize = [&testFile]() -> size_t {
+        std::ifstream logFile(testFile, std::ios::binary | std::ios::ate);
+        return logFile.is_open() ? static_cast<size_t>(logFile.tellg()) : 0u;
+    };
+
+    std::string entry(600, 'x');
+    fileLogger.writeToFile(testFile, entry.c_str(), entry.size(), std::ios::app);
+    EXPECT_EQ(0u, getFileSize());
+
+    fileLogger.writeToFile(testFile, entry.c_str(), entry.size(), std::ios::app);
+    EXPECT_EQ(2 * entry.size(), getFileSize());
+
+    fileLogger.writeToFile(testFile, "abc", 3, std::ios::app);
+    EXPECT_EQ(2 * entry.size(), getFileSize());
+
+    fileLogger.closeLogFile();
+    EXPECT_EQ(2 * entry.size() + 3, getFileSize());
+}
+
+TEST(FileLogger, GivenOpenedLogFileWithBufferedEntriesWhenWritingFileWithSameNameThenLogFileIsFlushedAndClosedBeforeWriting) {
+    std::string testFile = "testfile";
+    DebugVariables flags;
+    flags.LogFileBufferSize.set(1);
+    FullyEnabledFileLogger fileLogger(testFile, flags);
+    fileLogger.useRealFiles(true);
+
+    std::string entry(1100, 'x');
+    fileLogger.writeToFile(testFile, entry.c_str(), entry.size(), std::ios::app);
+    fileLogger.writeToFile(testFile, "abc", 3, std::ios::app);
+    EXPECT_TRUE(fileLogger.logFile.is_open());
+
+    fileLogger.writeToFile(testFile, "def", 3, std::ios::app | std::ios::out);
+    EXPECT_FALSE(fileLogger.logFile.is_open());
+
+    std::ifstream logFile(testFile);
+    std::stringstream fileContent;
+    fileContent << logFile.rdbuf();
+    EXPECT_EQ(entry + "abcdef", fileContent.str());
+}
+
 TEST(FileLogger, GivenFlagIsFalseWhenLoggingThenOnlyCustomLogsAreDumped) {
     std::string testFile = "testfile";
     DebugVariables flags;
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/periodic_task.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace NEO;
+
+TEST(PeriodicTaskTest, givenPeriodicTaskWhenStartedThenTaskIsCalledUntilStopped) {
+    std::atomic<uint32_t> callCount{0};
+    PeriodicTask periodicTask([&callCount]() { callCount++; }, std::chrono::microseconds(100));
+    EXPECT_FALSE(periodicTask.isRunning());
+
+    periodicTask.start();
+    EXPECT_TRUE(periodicTask.isRunning());
+    while (callCount < 2u) {
+        std::this_thread::yield();
+    }
+
+    periodicTask.stop();
+    EXPECT_FALSE(periodicTask.isRunning());
+    auto callCountAfterStop = callCount.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    EXPECT_EQ(callCountAfterStop, callCount.load());
+}
+
+TEST(PeriodicTaskTest, givenLongPeriodWhenStoppingThenThreadIsWokenWithoutWaitingForPeriod) {
+    std::atomic<uint32_t> callCount{0};
+    PeriodicTask periodicTask([&callCount]() { callCount++; }, std::chrono::hours(1));
+
+    periodicTask.start();
+    while (callCount < 1u) {
+        std::this_thread::yield();
+    }
+    periodicTask.stop();
+
+    EXPECT_FALSE(periodicTask.isRunning());
+    EXPECT_EQ(1u, callCount.load());
+}
+
+TEST(PeriodicTaskTest, givenPeriodicTaskWhenStartAndStopCalledRepeatedlyThenTaskCanBeRestarted) {
+    std::atomic<uint32_t> callCount{0};
+    PeriodicTask periodicTask([&callCount]() { callCount++; }, std::chrono::hours(1));
+
+    periodicTask.stop();
+    EXPECT_FALSE(periodicTask.isRunning());
+
+    periodicTask.start();
+    periodicTask.start();
+    while (callCount < 1u) {
+        std::this_thread::yield();
+    }
+    periodicTask.stop();
+    periodicTask.stop();
+    EXPECT_EQ(1u, callCount.load());
+
+    periodicTask.start();
+    while (callCount < 2u) {
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(periodicTask.isRunning());
+}